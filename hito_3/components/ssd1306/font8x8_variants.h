@@ -0,0 +1,433 @@
+/*
+ * font8x8_variants.h
+ *
+ * Inverted and flipped copies of font8x8_basic_tr, so that a glyph can be
+ * drawn with a single copy from the table matching the device state instead
+ * of running ssd1306_invert()/ssd1306_flip() on every character.
+ *
+ * Generated from font8x8_basic_tr with the following procedure:
+
+	for (int variant = 1; variant < 4; variant++) {
+		for (int code = 0; code < 128; code++) {
+			uint8_t glyph[8];
+			for (int w = 0; w < 8; w++) {
+				glyph[w] = font8x8_basic_tr[code][w];
+				if (variant & FONT8X8_INVERT) glyph[w] = ~glyph[w];
+				if (variant & FONT8X8_FLIP) glyph[w] = ssd1306_rotate_byte(glyph[w]);
+			}
+			// print glyph as in font8x8_basic.h
+		}
+	}
+ */
+
+#ifndef MAIN_FONT8X8_VARIANTS_H_
+#define MAIN_FONT8X8_VARIANTS_H_
+
+#include "font8x8_basic.h"
+
+#define FONT8X8_INVERT	0x01
+#define FONT8X8_FLIP	0x02
+
+
+static const uint8_t font8x8_basic_tr_inv[128][8] = {
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0000 (nul)
+    { 0xFF, 0xFB, 0xFD, 0x00, 0xFD, 0xFB, 0xFF, 0xFF },   // U+0001 (Up Allow)
+    { 0xFF, 0xDF, 0xBF, 0x00, 0xBF, 0xDF, 0xFF, 0xFF },   // U+0002 (Down Allow)
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0003
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0004
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0005
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0006
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0007
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0008
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0009
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000A
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000B
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000C
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000D
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000E
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000F
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0010
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0011
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0012
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0013
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0014
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0015
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0016
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0017
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0018
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0019
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001A
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001B
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001C
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001D
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001E
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001F
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0020 (space)
+    { 0xFF, 0xFF, 0xF9, 0xA0, 0xA0, 0xF9, 0xFF, 0xFF },   // U+0021 (!)
+    { 0xFF, 0xFC, 0xFC, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF },   // U+0022 (")
+    { 0xEB, 0x80, 0x80, 0xEB, 0x80, 0x80, 0xEB, 0xFF },   // U+0023 (#)
+    { 0xDB, 0xD1, 0x94, 0x94, 0xC5, 0xED, 0xFF, 0xFF },   // U+0024 ($)
+    { 0xB9, 0x99, 0xCF, 0xE7, 0xF3, 0x99, 0x9D, 0xFF },   // U+0025 (%)
+    { 0xCF, 0x85, 0xB0, 0xA2, 0xC8, 0x85, 0xB7, 0xFF },   // U+0026 (&)
+    { 0xFB, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0027 (')
+    { 0xFF, 0xE3, 0xC1, 0x9C, 0xBE, 0xFF, 0xFF, 0xFF },   // U+0028 (()
+    { 0xFF, 0xBE, 0x9C, 0xC1, 0xE3, 0xFF, 0xFF, 0xFF },   // U+0029 ())
+    { 0xF7, 0xD5, 0xC1, 0xE3, 0xE3, 0xC1, 0xD5, 0xF7 },   // U+002A (*)
+    { 0xF7, 0xF7, 0xC1, 0xC1, 0xF7, 0xF7, 0xFF, 0xFF },   // U+002B (+)
+    { 0xFF, 0x7F, 0x1F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF },   // U+002C (,)
+    { 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFF, 0xFF },   // U+002D (-)
+    { 0xFF, 0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF },   // U+002E (.)
+    { 0x9F, 0xCF, 0xE7, 0xF3, 0xF9, 0xFC, 0xFE, 0xFF },   // U+002F (/)
+    { 0xC1, 0x80, 0x8E, 0xA6, 0xB2, 0x80, 0xC1, 0xFF },   // U+0030 (0)
+    { 0xBF, 0xBD, 0x80, 0x80, 0xBF, 0xBF, 0xFF, 0xFF },   // U+0031 (1)
+    { 0x9D, 0x8C, 0xA6, 0xB6, 0x90, 0x99, 0xFF, 0xFF },   // U+0032 (2)
+    { 0xDD, 0x9C, 0xB6, 0xB6, 0x80, 0xC9, 0xFF, 0xFF },   // U+0033 (3)
+    { 0xE7, 0xE3, 0xE9, 0xAC, 0x80, 0x80, 0xAF, 0xFF },   // U+0034 (4)
+    { 0xD8, 0x98, 0xBA, 0xBA, 0x82, 0xC6, 0xFF, 0xFF },   // U+0035 (5)
+    { 0xC3, 0x81, 0xB4, 0xB6, 0x86, 0xCF, 0xFF, 0xFF },   // U+0036 (6)
+    { 0xFC, 0xFC, 0x8E, 0x86, 0xF0, 0xF8, 0xFF, 0xFF },   // U+0037 (7)
+    { 0xC9, 0x80, 0xB6, 0xB6, 0x80, 0xC9, 0xFF, 0xFF },   // U+0038 (8)
+    { 0xF9, 0xB0, 0xB6, 0x96, 0xC0, 0xE1, 0xFF, 0xFF },   // U+0039 (9)
+    { 0xFF, 0xFF, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0xFF },   // U+003A (:)
+    { 0xFF, 0x7F, 0x19, 0x99, 0xFF, 0xFF, 0xFF, 0xFF },   // U+003B (;)
+    { 0xF7, 0xE3, 0xC9, 0x9C, 0xBE, 0xFF, 0xFF, 0xFF },   // U+003C (<)
+    { 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xFF, 0xFF },   // U+003D (=)
+    { 0xFF, 0xBE, 0x9C, 0xC9, 0xE3, 0xF7, 0xFF, 0xFF },   // U+003E (>)
+    { 0xFD, 0xFC, 0xAE, 0xA6, 0xF0, 0xF9, 0xFF, 0xFF },   // U+003F (?)
+    { 0xC1, 0x80, 0xBE, 0xA2, 0xA2, 0xE0, 0xE1, 0xFF },   // U+0040 (@)
+    { 0x83, 0x81, 0xEC, 0xEC, 0x81, 0x83, 0xFF, 0xFF },   // U+0041 (A)
+    { 0xBE, 0x80, 0x80, 0xB6, 0xB6, 0x80, 0xC9, 0xFF },   // U+0042 (B)
+    { 0xE3, 0xC1, 0x9C, 0xBE, 0xBE, 0x9C, 0xDD, 0xFF },   // U+0043 (C)
+    { 0xBE, 0x80, 0x80, 0xBE, 0x9C, 0xC1, 0xE3, 0xFF },   // U+0044 (D)
+    { 0xBE, 0x80, 0x80, 0xB6, 0xA2, 0xBE, 0x9C, 0xFF },   // U+0045 (E)
+    { 0xBE, 0x80, 0x80, 0xB6, 0xE2, 0xFE, 0xFC, 0xFF },   // U+0046 (F)
+    { 0xE3, 0xC1, 0x9C, 0xBE, 0xAE, 0x8C, 0x8D, 0xFF },   // U+0047 (G)
+    { 0x80, 0x80, 0xF7, 0xF7, 0x80, 0x80, 0xFF, 0xFF },   // U+0048 (H)
+    { 0xFF, 0xBE, 0x80, 0x80, 0xBE, 0xFF, 0xFF, 0xFF },   // U+0049 (I)
+    { 0xCF, 0x8F, 0xBF, 0xBE, 0x80, 0xC0, 0xFE, 0xFF },   // U+004A (J)
+    { 0xBE, 0x80, 0x80, 0xF7, 0xE3, 0x88, 0x9C, 0xFF },   // U+004B (K)
+    { 0xBE, 0x80, 0x80, 0xBE, 0xBF, 0x9F, 0x8F, 0xFF },   // U+004C (L)
+    { 0x80, 0x80, 0xF1, 0xE3, 0xF1, 0x80, 0x80, 0xFF },   // U+004D (M)
+    { 0x80, 0x80, 0xF9, 0xF3, 0xE7, 0x80, 0x80, 0xFF },   // U+004E (N)
+    { 0xE3, 0xC1, 0x9C, 0xBE, 0x9C, 0xC1, 0xE3, 0xFF },   // U+004F (O)
+    { 0xBE, 0x80, 0x80, 0xB6, 0xF6, 0xF0, 0xF9, 0xFF },   // U+0050 (P)
+    { 0xE1, 0xC0, 0xDE, 0x8E, 0x80, 0xA1, 0xFF, 0xFF },   // U+0051 (Q)
+    { 0xBE, 0x80, 0x80, 0xF6, 0xE6, 0x80, 0x99, 0xFF },   // U+0052 (R)
+    { 0xD9, 0x90, 0xB2, 0xA6, 0x8C, 0xCD, 0xFF, 0xFF },   // U+0053 (S)
+    { 0xFC, 0xBE, 0x80, 0x80, 0xBE, 0xFC, 0xFF, 0xFF },   // U+0054 (T)
+    { 0x80, 0x80, 0xBF, 0xBF, 0x80, 0x80, 0xFF, 0xFF },   // U+0055 (U)
+    { 0xE0, 0xC0, 0x9F, 0x9F, 0xC0, 0xE0, 0xFF, 0xFF },   // U+0056 (V)
+    { 0x80, 0x80, 0xCF, 0xE7, 0xCF, 0x80, 0x80, 0xFF },   // U+0057 (W)
+    { 0xBC, 0x98, 0xC3, 0xE7, 0xC3, 0x98, 0xBC, 0xFF },   // U+0058 (X)
+    { 0xF8, 0xB0, 0x87, 0x87, 0xB0, 0xF8, 0xFF, 0xFF },   // U+0059 (Y)
+    { 0xB8, 0x9C, 0x8E, 0xA6, 0xB2, 0x98, 0x8C, 0xFF },   // U+005A (Z)
+    { 0xFF, 0x80, 0x80, 0xBE, 0xBE, 0xFF, 0xFF, 0xFF },   // U+005B ([)
+    { 0xFE, 0xFC, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0xFF },   // U+005C (\)
+    { 0xFF, 0xBE, 0xBE, 0x80, 0x80, 0xFF, 0xFF, 0xFF },   // U+005D (])
+    { 0xF7, 0xF3, 0xF9, 0xFC, 0xF9, 0xF3, 0xF7, 0xFF },   // U+005E (^)
+    { 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F },   // U+005F (_)
+    { 0xFF, 0xFF, 0xFC, 0xF8, 0xFB, 0xFF, 0xFF, 0xFF },   // U+0060 (`)
+    { 0xDF, 0x8B, 0xAB, 0xAB, 0xC3, 0x87, 0xBF, 0xFF },   // U+0061 (a)
+    { 0xBE, 0x80, 0xC0, 0xB7, 0xB7, 0x87, 0xCF, 0xFF },   // U+0062 (b)
+    { 0xC7, 0x83, 0xBB, 0xBB, 0x93, 0xD7, 0xFF, 0xFF },   // U+0063 (c)
+    { 0xCF, 0x87, 0xB7, 0xB6, 0xC0, 0x80, 0xBF, 0xFF },   // U+0064 (d)
+    { 0xC7, 0x83, 0xAB, 0xAB, 0xA3, 0xE7, 0xFF, 0xFF },   // U+0065 (e)
+    { 0xB7, 0x81, 0x80, 0xB6, 0xFC, 0xFD, 0xFF, 0xFF },   // U+0066 (f)
+    { 0x67, 0x43, 0x5B, 0x5B, 0x07, 0x83, 0xFB, 0xFF },   // U+0067 (g)
+    { 0xBE, 0x80, 0x80, 0xF7, 0xFB, 0x83, 0x87, 0xFF },   // U+0068 (h)
+    { 0xFF, 0xBB, 0x82, 0x82, 0xBF, 0xFF, 0xFF, 0xFF },   // U+0069 (i)
+    { 0x9F, 0x1F, 0x7F, 0x7F, 0x02, 0x82, 0xFF, 0xFF },   // U+006A (j)
+    { 0xBE, 0x80, 0x80, 0xEF, 0xC7, 0x93, 0xBB, 0xFF },   // U+006B (k)
+    { 0xFF, 0xBE, 0x80, 0x80, 0xBF, 0xFF, 0xFF, 0xFF },   // U+006C (l)
+    { 0x83, 0x83, 0xE7, 0xC7, 0xE3, 0x83, 0x87, 0xFF },   // U+006D (m)
+    { 0x83, 0x83, 0xFB, 0xFB, 0x83, 0x87, 0xFF, 0xFF },   // U+006E (n)
+    { 0xC7, 0x83, 0xBB, 0xBB, 0x83, 0xC7, 0xFF, 0xFF },   // U+006F (o)
+    { 0x7B, 0x03, 0x07, 0x5B, 0xDB, 0xC3, 0xE7, 0xFF },   // U+0070 (p)
+    { 0xE7, 0xC3, 0xDB, 0x5B, 0x07, 0x03, 0x7B, 0xFF },   // U+0071 (q)
+    { 0xBB, 0x83, 0x87, 0xB3, 0xFB, 0xE3, 0xE7, 0xFF },   // U+0072 (r)
+    { 0xB7, 0xA3, 0xAB, 0xAB, 0x8B, 0xDB, 0xFF, 0xFF },   // U+0073 (s)
+    { 0xFF, 0xFB, 0xC1, 0x80, 0xBB, 0xDB, 0xFF, 0xFF },   // U+0074 (t)
+    { 0xC3, 0x83, 0xBF, 0xBF, 0xC3, 0x83, 0xBF, 0xFF },   // U+0075 (u)
+    { 0xE3, 0xC3, 0x9F, 0x9F, 0xC3, 0xE3, 0xFF, 0xFF },   // U+0076 (v)
+    { 0xC3, 0x83, 0x8F, 0xC7, 0x8F, 0x83, 0xC3, 0xFF },   // U+0077 (w)
+    { 0xBB, 0x93, 0xC7, 0xEF, 0xC7, 0x93, 0xBB, 0xFF },   // U+0078 (x)
+    { 0x63, 0x43, 0x5F, 0x5F, 0x03, 0x83, 0xFF, 0xFF },   // U+0079 (y)
+    { 0xB3, 0x9B, 0x8B, 0xA3, 0xB3, 0x9B, 0xFF, 0xFF },   // U+007A (z)
+    { 0xF7, 0xF7, 0xC1, 0x88, 0xBE, 0xBE, 0xFF, 0xFF },   // U+007B ({)
+    { 0xFF, 0xFF, 0xFF, 0x88, 0x88, 0xFF, 0xFF, 0xFF },   // U+007C (|)
+    { 0xBE, 0xBE, 0x88, 0xC1, 0xF7, 0xF7, 0xFF, 0xFF },   // U+007D (})
+    { 0xFD, 0xFC, 0xFE, 0xFC, 0xFD, 0xFC, 0xFE, 0xFF },   // U+007E (~)
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }    // U+007F
+};
+
+static const uint8_t font8x8_basic_tr_flip[128][8] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0000 (nul)
+    { 0x00, 0x20, 0x40, 0xFF, 0x40, 0x20, 0x00, 0x00 },   // U+0001 (Up Allow)
+    { 0x00, 0x04, 0x02, 0xFF, 0x02, 0x04, 0x00, 0x00 },   // U+0002 (Down Allow)
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0003
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0004
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0005
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0006
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0007
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0008
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0009
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+000A
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+000B
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+000C
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+000D
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+000E
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+000F
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0010
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0011
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0012
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0013
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0014
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0015
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0016
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0017
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0018
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0019
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+001A
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+001B
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+001C
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+001D
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+001E
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+001F
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0020 (space)
+    { 0x00, 0x00, 0x60, 0xFA, 0xFA, 0x60, 0x00, 0x00 },   // U+0021 (!)
+    { 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0x00 },   // U+0022 (")
+    { 0x28, 0xFE, 0xFE, 0x28, 0xFE, 0xFE, 0x28, 0x00 },   // U+0023 (#)
+    { 0x24, 0x74, 0xD6, 0xD6, 0x5C, 0x48, 0x00, 0x00 },   // U+0024 ($)
+    { 0x62, 0x66, 0x0C, 0x18, 0x30, 0x66, 0x46, 0x00 },   // U+0025 (%)
+    { 0x0C, 0x5E, 0xF2, 0xBA, 0xEC, 0x5E, 0x12, 0x00 },   // U+0026 (&)
+    { 0x20, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00 },   // U+0027 (')
+    { 0x00, 0x38, 0x7C, 0xC6, 0x82, 0x00, 0x00, 0x00 },   // U+0028 (()
+    { 0x00, 0x82, 0xC6, 0x7C, 0x38, 0x00, 0x00, 0x00 },   // U+0029 ())
+    { 0x10, 0x54, 0x7C, 0x38, 0x38, 0x7C, 0x54, 0x10 },   // U+002A (*)
+    { 0x10, 0x10, 0x7C, 0x7C, 0x10, 0x10, 0x00, 0x00 },   // U+002B (+)
+    { 0x00, 0x01, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00 },   // U+002C (,)
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },   // U+002D (-)
+    { 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00 },   // U+002E (.)
+    { 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x00 },   // U+002F (/)
+    { 0x7C, 0xFE, 0x8E, 0x9A, 0xB2, 0xFE, 0x7C, 0x00 },   // U+0030 (0)
+    { 0x02, 0x42, 0xFE, 0xFE, 0x02, 0x02, 0x00, 0x00 },   // U+0031 (1)
+    { 0x46, 0xCE, 0x9A, 0x92, 0xF6, 0x66, 0x00, 0x00 },   // U+0032 (2)
+    { 0x44, 0xC6, 0x92, 0x92, 0xFE, 0x6C, 0x00, 0x00 },   // U+0033 (3)
+    { 0x18, 0x38, 0x68, 0xCA, 0xFE, 0xFE, 0x0A, 0x00 },   // U+0034 (4)
+    { 0xE4, 0xE6, 0xA2, 0xA2, 0xBE, 0x9C, 0x00, 0x00 },   // U+0035 (5)
+    { 0x3C, 0x7E, 0xD2, 0x92, 0x9E, 0x0C, 0x00, 0x00 },   // U+0036 (6)
+    { 0xC0, 0xC0, 0x8E, 0x9E, 0xF0, 0xE0, 0x00, 0x00 },   // U+0037 (7)
+    { 0x6C, 0xFE, 0x92, 0x92, 0xFE, 0x6C, 0x00, 0x00 },   // U+0038 (8)
+    { 0x60, 0xF2, 0x92, 0x96, 0xFC, 0x78, 0x00, 0x00 },   // U+0039 (9)
+    { 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00 },   // U+003A (:)
+    { 0x00, 0x01, 0x67, 0x66, 0x00, 0x00, 0x00, 0x00 },   // U+003B (;)
+    { 0x10, 0x38, 0x6C, 0xC6, 0x82, 0x00, 0x00, 0x00 },   // U+003C (<)
+    { 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00 },   // U+003D (=)
+    { 0x00, 0x82, 0xC6, 0x6C, 0x38, 0x10, 0x00, 0x00 },   // U+003E (>)
+    { 0x40, 0xC0, 0x8A, 0x9A, 0xF0, 0x60, 0x00, 0x00 },   // U+003F (?)
+    { 0x7C, 0xFE, 0x82, 0xBA, 0xBA, 0xF8, 0x78, 0x00 },   // U+0040 (@)
+    { 0x3E, 0x7E, 0xC8, 0xC8, 0x7E, 0x3E, 0x00, 0x00 },   // U+0041 (A)
+    { 0x82, 0xFE, 0xFE, 0x92, 0x92, 0xFE, 0x6C, 0x00 },   // U+0042 (B)
+    { 0x38, 0x7C, 0xC6, 0x82, 0x82, 0xC6, 0x44, 0x00 },   // U+0043 (C)
+    { 0x82, 0xFE, 0xFE, 0x82, 0xC6, 0x7C, 0x38, 0x00 },   // U+0044 (D)
+    { 0x82, 0xFE, 0xFE, 0x92, 0xBA, 0x82, 0xC6, 0x00 },   // U+0045 (E)
+    { 0x82, 0xFE, 0xFE, 0x92, 0xB8, 0x80, 0xC0, 0x00 },   // U+0046 (F)
+    { 0x38, 0x7C, 0xC6, 0x82, 0x8A, 0xCE, 0x4E, 0x00 },   // U+0047 (G)
+    { 0xFE, 0xFE, 0x10, 0x10, 0xFE, 0xFE, 0x00, 0x00 },   // U+0048 (H)
+    { 0x00, 0x82, 0xFE, 0xFE, 0x82, 0x00, 0x00, 0x00 },   // U+0049 (I)
+    { 0x0C, 0x0E, 0x02, 0x82, 0xFE, 0xFC, 0x80, 0x00 },   // U+004A (J)
+    { 0x82, 0xFE, 0xFE, 0x10, 0x38, 0xEE, 0xC6, 0x00 },   // U+004B (K)
+    { 0x82, 0xFE, 0xFE, 0x82, 0x02, 0x06, 0x0E, 0x00 },   // U+004C (L)
+    { 0xFE, 0xFE, 0x70, 0x38, 0x70, 0xFE, 0xFE, 0x00 },   // U+004D (M)
+    { 0xFE, 0xFE, 0x60, 0x30, 0x18, 0xFE, 0xFE, 0x00 },   // U+004E (N)
+    { 0x38, 0x7C, 0xC6, 0x82, 0xC6, 0x7C, 0x38, 0x00 },   // U+004F (O)
+    { 0x82, 0xFE, 0xFE, 0x92, 0x90, 0xF0, 0x60, 0x00 },   // U+0050 (P)
+    { 0x78, 0xFC, 0x84, 0x8E, 0xFE, 0x7A, 0x00, 0x00 },   // U+0051 (Q)
+    { 0x82, 0xFE, 0xFE, 0x90, 0x98, 0xFE, 0x66, 0x00 },   // U+0052 (R)
+    { 0x64, 0xF6, 0xB2, 0x9A, 0xCE, 0x4C, 0x00, 0x00 },   // U+0053 (S)
+    { 0xC0, 0x82, 0xFE, 0xFE, 0x82, 0xC0, 0x00, 0x00 },   // U+0054 (T)
+    { 0xFE, 0xFE, 0x02, 0x02, 0xFE, 0xFE, 0x00, 0x00 },   // U+0055 (U)
+    { 0xF8, 0xFC, 0x06, 0x06, 0xFC, 0xF8, 0x00, 0x00 },   // U+0056 (V)
+    { 0xFE, 0xFE, 0x0C, 0x18, 0x0C, 0xFE, 0xFE, 0x00 },   // U+0057 (W)
+    { 0xC2, 0xE6, 0x3C, 0x18, 0x3C, 0xE6, 0xC2, 0x00 },   // U+0058 (X)
+    { 0xE0, 0xF2, 0x1E, 0x1E, 0xF2, 0xE0, 0x00, 0x00 },   // U+0059 (Y)
+    { 0xE2, 0xC6, 0x8E, 0x9A, 0xB2, 0xE6, 0xCE, 0x00 },   // U+005A (Z)
+    { 0x00, 0xFE, 0xFE, 0x82, 0x82, 0x00, 0x00, 0x00 },   // U+005B ([)
+    { 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x00 },   // U+005C (\)
+    { 0x00, 0x82, 0x82, 0xFE, 0xFE, 0x00, 0x00, 0x00 },   // U+005D (])
+    { 0x10, 0x30, 0x60, 0xC0, 0x60, 0x30, 0x10, 0x00 },   // U+005E (^)
+    { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },   // U+005F (_)
+    { 0x00, 0x00, 0xC0, 0xE0, 0x20, 0x00, 0x00, 0x00 },   // U+0060 (`)
+    { 0x04, 0x2E, 0x2A, 0x2A, 0x3C, 0x1E, 0x02, 0x00 },   // U+0061 (a)
+    { 0x82, 0xFE, 0xFC, 0x12, 0x12, 0x1E, 0x0C, 0x00 },   // U+0062 (b)
+    { 0x1C, 0x3E, 0x22, 0x22, 0x36, 0x14, 0x00, 0x00 },   // U+0063 (c)
+    { 0x0C, 0x1E, 0x12, 0x92, 0xFC, 0xFE, 0x02, 0x00 },   // U+0064 (d)
+    { 0x1C, 0x3E, 0x2A, 0x2A, 0x3A, 0x18, 0x00, 0x00 },   // U+0065 (e)
+    { 0x12, 0x7E, 0xFE, 0x92, 0xC0, 0x40, 0x00, 0x00 },   // U+0066 (f)
+    { 0x19, 0x3D, 0x25, 0x25, 0x1F, 0x3E, 0x20, 0x00 },   // U+0067 (g)
+    { 0x82, 0xFE, 0xFE, 0x10, 0x20, 0x3E, 0x1E, 0x00 },   // U+0068 (h)
+    { 0x00, 0x22, 0xBE, 0xBE, 0x02, 0x00, 0x00, 0x00 },   // U+0069 (i)
+    { 0x06, 0x07, 0x01, 0x01, 0xBF, 0xBE, 0x00, 0x00 },   // U+006A (j)
+    { 0x82, 0xFE, 0xFE, 0x08, 0x1C, 0x36, 0x22, 0x00 },   // U+006B (k)
+    { 0x00, 0x82, 0xFE, 0xFE, 0x02, 0x00, 0x00, 0x00 },   // U+006C (l)
+    { 0x3E, 0x3E, 0x18, 0x1C, 0x38, 0x3E, 0x1E, 0x00 },   // U+006D (m)
+    { 0x3E, 0x3E, 0x20, 0x20, 0x3E, 0x1E, 0x00, 0x00 },   // U+006E (n)
+    { 0x1C, 0x3E, 0x22, 0x22, 0x3E, 0x1C, 0x00, 0x00 },   // U+006F (o)
+    { 0x21, 0x3F, 0x1F, 0x25, 0x24, 0x3C, 0x18, 0x00 },   // U+0070 (p)
+    { 0x18, 0x3C, 0x24, 0x25, 0x1F, 0x3F, 0x21, 0x00 },   // U+0071 (q)
+    { 0x22, 0x3E, 0x1E, 0x32, 0x20, 0x38, 0x18, 0x00 },   // U+0072 (r)
+    { 0x12, 0x3A, 0x2A, 0x2A, 0x2E, 0x24, 0x00, 0x00 },   // U+0073 (s)
+    { 0x00, 0x20, 0x7C, 0xFE, 0x22, 0x24, 0x00, 0x00 },   // U+0074 (t)
+    { 0x3C, 0x3E, 0x02, 0x02, 0x3C, 0x3E, 0x02, 0x00 },   // U+0075 (u)
+    { 0x38, 0x3C, 0x06, 0x06, 0x3C, 0x38, 0x00, 0x00 },   // U+0076 (v)
+    { 0x3C, 0x3E, 0x0E, 0x1C, 0x0E, 0x3E, 0x3C, 0x00 },   // U+0077 (w)
+    { 0x22, 0x36, 0x1C, 0x08, 0x1C, 0x36, 0x22, 0x00 },   // U+0078 (x)
+    { 0x39, 0x3D, 0x05, 0x05, 0x3F, 0x3E, 0x00, 0x00 },   // U+0079 (y)
+    { 0x32, 0x26, 0x2E, 0x3A, 0x32, 0x26, 0x00, 0x00 },   // U+007A (z)
+    { 0x10, 0x10, 0x7C, 0xEE, 0x82, 0x82, 0x00, 0x00 },   // U+007B ({)
+    { 0x00, 0x00, 0x00, 0xEE, 0xEE, 0x00, 0x00, 0x00 },   // U+007C (|)
+    { 0x82, 0x82, 0xEE, 0x7C, 0x10, 0x10, 0x00, 0x00 },   // U+007D (})
+    { 0x40, 0xC0, 0x80, 0xC0, 0x40, 0xC0, 0x80, 0x00 },   // U+007E (~)
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }    // U+007F
+};
+
+static const uint8_t font8x8_basic_tr_flip_inv[128][8] = {
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0000 (nul)
+    { 0xFF, 0xDF, 0xBF, 0x00, 0xBF, 0xDF, 0xFF, 0xFF },   // U+0001 (Up Allow)
+    { 0xFF, 0xFB, 0xFD, 0x00, 0xFD, 0xFB, 0xFF, 0xFF },   // U+0002 (Down Allow)
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0003
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0004
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0005
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0006
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0007
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0008
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0009
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000A
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000B
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000C
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000D
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000E
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+000F
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0010
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0011
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0012
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0013
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0014
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0015
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0016
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0017
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0018
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0019
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001A
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001B
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001C
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001D
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001E
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+001F
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0020 (space)
+    { 0xFF, 0xFF, 0x9F, 0x05, 0x05, 0x9F, 0xFF, 0xFF },   // U+0021 (!)
+    { 0xFF, 0x3F, 0x3F, 0xFF, 0x3F, 0x3F, 0xFF, 0xFF },   // U+0022 (")
+    { 0xD7, 0x01, 0x01, 0xD7, 0x01, 0x01, 0xD7, 0xFF },   // U+0023 (#)
+    { 0xDB, 0x8B, 0x29, 0x29, 0xA3, 0xB7, 0xFF, 0xFF },   // U+0024 ($)
+    { 0x9D, 0x99, 0xF3, 0xE7, 0xCF, 0x99, 0xB9, 0xFF },   // U+0025 (%)
+    { 0xF3, 0xA1, 0x0D, 0x45, 0x13, 0xA1, 0xED, 0xFF },   // U+0026 (&)
+    { 0xDF, 0x1F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF },   // U+0027 (')
+    { 0xFF, 0xC7, 0x83, 0x39, 0x7D, 0xFF, 0xFF, 0xFF },   // U+0028 (()
+    { 0xFF, 0x7D, 0x39, 0x83, 0xC7, 0xFF, 0xFF, 0xFF },   // U+0029 ())
+    { 0xEF, 0xAB, 0x83, 0xC7, 0xC7, 0x83, 0xAB, 0xEF },   // U+002A (*)
+    { 0xEF, 0xEF, 0x83, 0x83, 0xEF, 0xEF, 0xFF, 0xFF },   // U+002B (+)
+    { 0xFF, 0xFE, 0xF8, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF },   // U+002C (,)
+    { 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xFF, 0xFF },   // U+002D (-)
+    { 0xFF, 0xFF, 0xF9, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF },   // U+002E (.)
+    { 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3F, 0x7F, 0xFF },   // U+002F (/)
+    { 0x83, 0x01, 0x71, 0x65, 0x4D, 0x01, 0x83, 0xFF },   // U+0030 (0)
+    { 0xFD, 0xBD, 0x01, 0x01, 0xFD, 0xFD, 0xFF, 0xFF },   // U+0031 (1)
+    { 0xB9, 0x31, 0x65, 0x6D, 0x09, 0x99, 0xFF, 0xFF },   // U+0032 (2)
+    { 0xBB, 0x39, 0x6D, 0x6D, 0x01, 0x93, 0xFF, 0xFF },   // U+0033 (3)
+    { 0xE7, 0xC7, 0x97, 0x35, 0x01, 0x01, 0xF5, 0xFF },   // U+0034 (4)
+    { 0x1B, 0x19, 0x5D, 0x5D, 0x41, 0x63, 0xFF, 0xFF },   // U+0035 (5)
+    { 0xC3, 0x81, 0x2D, 0x6D, 0x61, 0xF3, 0xFF, 0xFF },   // U+0036 (6)
+    { 0x3F, 0x3F, 0x71, 0x61, 0x0F, 0x1F, 0xFF, 0xFF },   // U+0037 (7)
+    { 0x93, 0x01, 0x6D, 0x6D, 0x01, 0x93, 0xFF, 0xFF },   // U+0038 (8)
+    { 0x9F, 0x0D, 0x6D, 0x69, 0x03, 0x87, 0xFF, 0xFF },   // U+0039 (9)
+    { 0xFF, 0xFF, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0xFF },   // U+003A (:)
+    { 0xFF, 0xFE, 0x98, 0x99, 0xFF, 0xFF, 0xFF, 0xFF },   // U+003B (;)
+    { 0xEF, 0xC7, 0x93, 0x39, 0x7D, 0xFF, 0xFF, 0xFF },   // U+003C (<)
+    { 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xFF, 0xFF },   // U+003D (=)
+    { 0xFF, 0x7D, 0x39, 0x93, 0xC7, 0xEF, 0xFF, 0xFF },   // U+003E (>)
+    { 0xBF, 0x3F, 0x75, 0x65, 0x0F, 0x9F, 0xFF, 0xFF },   // U+003F (?)
+    { 0x83, 0x01, 0x7D, 0x45, 0x45, 0x07, 0x87, 0xFF },   // U+0040 (@)
+    { 0xC1, 0x81, 0x37, 0x37, 0x81, 0xC1, 0xFF, 0xFF },   // U+0041 (A)
+    { 0x7D, 0x01, 0x01, 0x6D, 0x6D, 0x01, 0x93, 0xFF },   // U+0042 (B)
+    { 0xC7, 0x83, 0x39, 0x7D, 0x7D, 0x39, 0xBB, 0xFF },   // U+0043 (C)
+    { 0x7D, 0x01, 0x01, 0x7D, 0x39, 0x83, 0xC7, 0xFF },   // U+0044 (D)
+    { 0x7D, 0x01, 0x01, 0x6D, 0x45, 0x7D, 0x39, 0xFF },   // U+0045 (E)
+    { 0x7D, 0x01, 0x01, 0x6D, 0x47, 0x7F, 0x3F, 0xFF },   // U+0046 (F)
+    { 0xC7, 0x83, 0x39, 0x7D, 0x75, 0x31, 0xB1, 0xFF },   // U+0047 (G)
+    { 0x01, 0x01, 0xEF, 0xEF, 0x01, 0x01, 0xFF, 0xFF },   // U+0048 (H)
+    { 0xFF, 0x7D, 0x01, 0x01, 0x7D, 0xFF, 0xFF, 0xFF },   // U+0049 (I)
+    { 0xF3, 0xF1, 0xFD, 0x7D, 0x01, 0x03, 0x7F, 0xFF },   // U+004A (J)
+    { 0x7D, 0x01, 0x01, 0xEF, 0xC7, 0x11, 0x39, 0xFF },   // U+004B (K)
+    { 0x7D, 0x01, 0x01, 0x7D, 0xFD, 0xF9, 0xF1, 0xFF },   // U+004C (L)
+    { 0x01, 0x01, 0x8F, 0xC7, 0x8F, 0x01, 0x01, 0xFF },   // U+004D (M)
+    { 0x01, 0x01, 0x9F, 0xCF, 0xE7, 0x01, 0x01, 0xFF },   // U+004E (N)
+    { 0xC7, 0x83, 0x39, 0x7D, 0x39, 0x83, 0xC7, 0xFF },   // U+004F (O)
+    { 0x7D, 0x01, 0x01, 0x6D, 0x6F, 0x0F, 0x9F, 0xFF },   // U+0050 (P)
+    { 0x87, 0x03, 0x7B, 0x71, 0x01, 0x85, 0xFF, 0xFF },   // U+0051 (Q)
+    { 0x7D, 0x01, 0x01, 0x6F, 0x67, 0x01, 0x99, 0xFF },   // U+0052 (R)
+    { 0x9B, 0x09, 0x4D, 0x65, 0x31, 0xB3, 0xFF, 0xFF },   // U+0053 (S)
+    { 0x3F, 0x7D, 0x01, 0x01, 0x7D, 0x3F, 0xFF, 0xFF },   // U+0054 (T)
+    { 0x01, 0x01, 0xFD, 0xFD, 0x01, 0x01, 0xFF, 0xFF },   // U+0055 (U)
+    { 0x07, 0x03, 0xF9, 0xF9, 0x03, 0x07, 0xFF, 0xFF },   // U+0056 (V)
+    { 0x01, 0x01, 0xF3, 0xE7, 0xF3, 0x01, 0x01, 0xFF },   // U+0057 (W)
+    { 0x3D, 0x19, 0xC3, 0xE7, 0xC3, 0x19, 0x3D, 0xFF },   // U+0058 (X)
+    { 0x1F, 0x0D, 0xE1, 0xE1, 0x0D, 0x1F, 0xFF, 0xFF },   // U+0059 (Y)
+    { 0x1D, 0x39, 0x71, 0x65, 0x4D, 0x19, 0x31, 0xFF },   // U+005A (Z)
+    { 0xFF, 0x01, 0x01, 0x7D, 0x7D, 0xFF, 0xFF, 0xFF },   // U+005B ([)
+    { 0x7F, 0x3F, 0x9F, 0xCF, 0xE7, 0xF3, 0xF9, 0xFF },   // U+005C (\)
+    { 0xFF, 0x7D, 0x7D, 0x01, 0x01, 0xFF, 0xFF, 0xFF },   // U+005D (])
+    { 0xEF, 0xCF, 0x9F, 0x3F, 0x9F, 0xCF, 0xEF, 0xFF },   // U+005E (^)
+    { 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE },   // U+005F (_)
+    { 0xFF, 0xFF, 0x3F, 0x1F, 0xDF, 0xFF, 0xFF, 0xFF },   // U+0060 (`)
+    { 0xFB, 0xD1, 0xD5, 0xD5, 0xC3, 0xE1, 0xFD, 0xFF },   // U+0061 (a)
+    { 0x7D, 0x01, 0x03, 0xED, 0xED, 0xE1, 0xF3, 0xFF },   // U+0062 (b)
+    { 0xE3, 0xC1, 0xDD, 0xDD, 0xC9, 0xEB, 0xFF, 0xFF },   // U+0063 (c)
+    { 0xF3, 0xE1, 0xED, 0x6D, 0x03, 0x01, 0xFD, 0xFF },   // U+0064 (d)
+    { 0xE3, 0xC1, 0xD5, 0xD5, 0xC5, 0xE7, 0xFF, 0xFF },   // U+0065 (e)
+    { 0xED, 0x81, 0x01, 0x6D, 0x3F, 0xBF, 0xFF, 0xFF },   // U+0066 (f)
+    { 0xE6, 0xC2, 0xDA, 0xDA, 0xE0, 0xC1, 0xDF, 0xFF },   // U+0067 (g)
+    { 0x7D, 0x01, 0x01, 0xEF, 0xDF, 0xC1, 0xE1, 0xFF },   // U+0068 (h)
+    { 0xFF, 0xDD, 0x41, 0x41, 0xFD, 0xFF, 0xFF, 0xFF },   // U+0069 (i)
+    { 0xF9, 0xF8, 0xFE, 0xFE, 0x40, 0x41, 0xFF, 0xFF },   // U+006A (j)
+    { 0x7D, 0x01, 0x01, 0xF7, 0xE3, 0xC9, 0xDD, 0xFF },   // U+006B (k)
+    { 0xFF, 0x7D, 0x01, 0x01, 0xFD, 0xFF, 0xFF, 0xFF },   // U+006C (l)
+    { 0xC1, 0xC1, 0xE7, 0xE3, 0xC7, 0xC1, 0xE1, 0xFF },   // U+006D (m)
+    { 0xC1, 0xC1, 0xDF, 0xDF, 0xC1, 0xE1, 0xFF, 0xFF },   // U+006E (n)
+    { 0xE3, 0xC1, 0xDD, 0xDD, 0xC1, 0xE3, 0xFF, 0xFF },   // U+006F (o)
+    { 0xDE, 0xC0, 0xE0, 0xDA, 0xDB, 0xC3, 0xE7, 0xFF },   // U+0070 (p)
+    { 0xE7, 0xC3, 0xDB, 0xDA, 0xE0, 0xC0, 0xDE, 0xFF },   // U+0071 (q)
+    { 0xDD, 0xC1, 0xE1, 0xCD, 0xDF, 0xC7, 0xE7, 0xFF },   // U+0072 (r)
+    { 0xED, 0xC5, 0xD5, 0xD5, 0xD1, 0xDB, 0xFF, 0xFF },   // U+0073 (s)
+    { 0xFF, 0xDF, 0x83, 0x01, 0xDD, 0xDB, 0xFF, 0xFF },   // U+0074 (t)
+    { 0xC3, 0xC1, 0xFD, 0xFD, 0xC3, 0xC1, 0xFD, 0xFF },   // U+0075 (u)
+    { 0xC7, 0xC3, 0xF9, 0xF9, 0xC3, 0xC7, 0xFF, 0xFF },   // U+0076 (v)
+    { 0xC3, 0xC1, 0xF1, 0xE3, 0xF1, 0xC1, 0xC3, 0xFF },   // U+0077 (w)
+    { 0xDD, 0xC9, 0xE3, 0xF7, 0xE3, 0xC9, 0xDD, 0xFF },   // U+0078 (x)
+    { 0xC6, 0xC2, 0xFA, 0xFA, 0xC0, 0xC1, 0xFF, 0xFF },   // U+0079 (y)
+    { 0xCD, 0xD9, 0xD1, 0xC5, 0xCD, 0xD9, 0xFF, 0xFF },   // U+007A (z)
+    { 0xEF, 0xEF, 0x83, 0x11, 0x7D, 0x7D, 0xFF, 0xFF },   // U+007B ({)
+    { 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0xFF, 0xFF, 0xFF },   // U+007C (|)
+    { 0x7D, 0x7D, 0x11, 0x83, 0xEF, 0xEF, 0xFF, 0xFF },   // U+007D (})
+    { 0xBF, 0x3F, 0x7F, 0x3F, 0xBF, 0x3F, 0x7F, 0xFF },   // U+007E (~)
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }    // U+007F
+};
+
+// Font table indexed by FONT8X8_INVERT | FONT8X8_FLIP
+static const uint8_t (* const font8x8_variants[4])[8] = {
+	font8x8_basic_tr,
+	font8x8_basic_tr_inv,
+	font8x8_basic_tr_flip,
+	font8x8_basic_tr_flip_inv,
+};
+
+#endif /* MAIN_FONT8X8_VARIANTS_H_ */
@@ -1,12 +1,28 @@
 #include <string.h>
+#include <inttypes.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "esp_log.h"
+#include "esp_timer.h"
+#if CONFIG_SCROLL_BENCHMARK || CONFIG_ROTATE_BENCHMARK
+#if CONFIG_IDF_TARGET_LINUX
+// No cycle counter on the host: the benchmarks report microseconds there
+#define esp_cpu_get_cycle_count() ((uint32_t)esp_timer_get_time())
+#else
+#include "esp_cpu.h"
+#endif
+#endif
 
 #include "ssd1306.h"
-#include "font8x8_basic.h"
+#include "font8x8_variants.h"
+
+// Approximate bus bytes per transfer besides the image data:
+// page mode sends 3 address commands and 2 control bytes per span,
+// a window sends 8 setup commands, 2 to restore page mode and 3 control bytes.
+#define PAGE_MODE_OVERHEAD 5
+#define WINDOW_MODE_OVERHEAD 13
 
 #define PACK8 __attribute__((aligned( __alignof__( uint8_t ) ), packed ))
 
@@ -15,16 +31,98 @@ typedef union out_column_t {
 	uint8_t  u8[4];
 } PACK8 out_column_t;
 
+// 3x scaled glyphs, already inverted/flipped, ready to send page by page
+#define X3_CACHE_SIZE 16
+
+typedef struct {
+	bool _valid;
+	uint8_t _code;
+	uint8_t _variant;
+	uint8_t _image[3][24];
+} x3_glyph_t;
+
+static x3_glyph_t x3_cache[X3_CACHE_SIZE];
+
+// Font table matching the invert flag and the flip state of the device
+static inline const uint8_t (* ssd1306_font(SSD1306_t * dev, bool invert))[8]
+{
+	return font8x8_variants[(invert ? FONT8X8_INVERT : 0) | (dev->_flip ? FONT8X8_FLIP : 0)];
+}
+
+static void ssd1306_clean_page(SSD1306_t * dev, int page)
+{
+	dev->_page[page]._dirtyStart = 128;
+	dev->_page[page]._dirtyEnd = -1;
+}
+
+// Write a span to the panel through the transport of this device.
+// Offscreen devices have no panel; ssd1306_page_sent() leaves the span dirty.
+static void ssd1306_panel_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width)
+{
+	if (dev->_address == FRAMEBUFFER_ADDRESS) {
+		fb_display_image(dev, page, seg, images, width);
+#if !CONFIG_IDF_TARGET_LINUX
+	} else if (dev->_address == SPI_ADDRESS) {
+		spi_display_image(dev, page, seg, images, width);
+	} else if (dev->_address != OFFSCREEN_ADDRESS) {
+		i2c_display_image(dev, page, seg, images, width);
+#endif
+	}
+}
+
+// The panel now holds [seg, seg+width) of this page.
+// Clear the dirty range if the transfer covered all of it.
+static void ssd1306_page_sent(SSD1306_t * dev, int page, int seg, int width)
+{
+	if (dev->_address == OFFSCREEN_ADDRESS) {
+		ssd1306_mark_dirty(dev, page, seg, seg + width - 1);
+		return;
+	}
+	if (page < 0 || page >= dev->_pages) return;
+	PAGE_t * p = &dev->_page[page];
+	if (seg <= p->_dirtyStart && seg + width - 1 >= p->_dirtyEnd) {
+		ssd1306_clean_page(dev, page);
+	}
+}
+
 void ssd1306_init(SSD1306_t * dev, int width, int height)
 {
-	if (dev->_address == SPI_ADDRESS) {
+	if (dev->_address == FRAMEBUFFER_ADDRESS) {
+		fb_init(dev, width, height);
+#if !CONFIG_IDF_TARGET_LINUX
+	} else if (dev->_address == SPI_ADDRESS) {
 		spi_init(dev, width, height);
 	} else {
 		i2c_init(dev, width, height);
+#endif
 	}
 	// Initialize internal buffer
 	for (int i=0;i<dev->_pages;i++) {
 		memset(dev->_page[i]._segs, 0, 128);
+		ssd1306_clean_page(dev, i);
+	}
+	dev->_txBytes = 0;
+	dev->_flushBytes = 0;
+#if CONFIG_SPI_THROUGHPUT_BENCHMARK
+#if !CONFIG_IDF_TARGET_LINUX
+	if (dev->_address == SPI_ADDRESS) spi_benchmark(dev, 20);
+#endif
+#endif
+}
+
+// Buffer-only device with the geometry, flip and current content of a panel.
+// Drawing on it never touches a bus; its dirty ranges tell what changed.
+void ssd1306_init_offscreen(SSD1306_t * dev, const SSD1306_t * panel)
+{
+	memset(dev, 0, sizeof(SSD1306_t));
+	dev->_address = OFFSCREEN_ADDRESS;
+	dev->_width = panel->_width;
+	dev->_height = panel->_height;
+	dev->_pages = panel->_pages;
+	dev->_flip = panel->_flip;
+	for (int i=0;i<dev->_pages;i++) {
+		memcpy(dev->_page[i]._segs, panel->_page[i]._segs, 128);
+		ssd1306_clean_page(dev, i);
 	}
 }
 
@@ -43,17 +141,122 @@ int ssd1306_get_pages(SSD1306_t * dev)
 	return dev->_pages;
 }
 
+// Send only what changed since the last flush. Each dirty page span costs a
+// command + data transfer pair in page addressing mode; when the bounding
+// rectangle of all spans is cheaper, it goes out as one horizontal-mode window.
 void ssd1306_show_buffer(SSD1306_t * dev)
 {
-	if (dev->_address == SPI_ADDRESS) {
-		for (int page=0; page<dev->_pages;page++) {
-			spi_display_image(dev, page, 0, dev->_page[page]._segs, dev->_width);
-		}
+	if (dev->_address == OFFSCREEN_ADDRESS) return;
+	uint32_t txBytes = dev->_txBytes;
+	int page_start = -1, page_end = -1;
+	int seg_start = dev->_width, seg_end = -1;
+	int page_cost = 0;
+	for (int page=0; page<dev->_pages;page++) {
+		PAGE_t * p = &dev->_page[page];
+		if (p->_dirtyStart > p->_dirtyEnd) continue;
+		if (page_start < 0) page_start = page;
+		page_end = page;
+		if (p->_dirtyStart < seg_start) seg_start = p->_dirtyStart;
+		if (p->_dirtyEnd > seg_end) seg_end = p->_dirtyEnd;
+		page_cost += PAGE_MODE_OVERHEAD + p->_dirtyEnd - p->_dirtyStart + 1;
+	}
+	if (page_start < 0) {
+		dev->_flushBytes = 0;
+		return;
+	}
+
+	int window_cost = WINDOW_MODE_OVERHEAD + (page_end - page_start + 1) * (seg_end - seg_start + 1);
+	if (window_cost < page_cost) {
+		ssd1306_show_window(dev, page_start, page_end, seg_start, seg_end);
 	} else {
-		for (int page=0; page<dev->_pages;page++) {
-			i2c_display_image(dev, page, 0, dev->_page[page]._segs, dev->_width);
+		for (int page=page_start; page<=page_end;page++) {
+			PAGE_t * p = &dev->_page[page];
+			if (p->_dirtyStart > p->_dirtyEnd) continue;
+			int seg = p->_dirtyStart;
+			int width = p->_dirtyEnd - p->_dirtyStart + 1;
+			ssd1306_panel_image(dev, page, seg, &p->_segs[seg], width);
+			ssd1306_clean_page(dev, page);
 		}
 	}
+	dev->_flushBytes = dev->_txBytes - txBytes;
+	ESP_LOGD(__FUNCTION__, "flush bytes=%"PRIu32, dev->_flushBytes);
+}
+
+// Send a rectangle of the internal buffer in one horizontal addressing burst
+void ssd1306_show_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end)
+{
+	if (page_start < 0) page_start = 0;
+	if (page_end >= dev->_pages) page_end = dev->_pages - 1;
+	if (seg_start < 0) seg_start = 0;
+	if (seg_end >= dev->_width) seg_end = dev->_width - 1;
+	if (page_start > page_end || seg_start > seg_end) return;
+
+	if (dev->_address == OFFSCREEN_ADDRESS) return;
+	if (dev->_address == FRAMEBUFFER_ADDRESS) {
+		fb_display_window(dev, page_start, page_end, seg_start, seg_end);
+#if !CONFIG_IDF_TARGET_LINUX
+	} else if (dev->_address == SPI_ADDRESS) {
+		spi_display_window(dev, page_start, page_end, seg_start, seg_end);
+	} else {
+		i2c_display_window(dev, page_start, page_end, seg_start, seg_end);
+#endif
+	}
+	for (int page=page_start; page<=page_end;page++) {
+		ssd1306_page_sent(dev, page, seg_start, seg_end - seg_start + 1);
+	}
+}
+
+// Send the whole framebuffer in one burst, whether it changed or not
+void ssd1306_show_frame(SSD1306_t * dev)
+{
+	ssd1306_show_window(dev, 0, dev->_pages - 1, 0, dev->_width - 1);
+}
+
+// Full-frame refreshes per second at the current bus clock
+float ssd1306_measure_fps(SSD1306_t * dev, int frames)
+{
+	int64_t start = esp_timer_get_time();
+	for (int i = 0; i < frames; i++) {
+		ssd1306_show_frame(dev);
+	}
+	int64_t elapsed = esp_timer_get_time() - start;
+	return (elapsed > 0) ? frames * 1000000.0f / elapsed : 0.0f;
+}
+
+// Extend the dirty column range of a page
+void ssd1306_mark_dirty(SSD1306_t * dev, int page, int seg_start, int seg_end)
+{
+	if (page < 0 || page >= dev->_pages) return;
+	if (seg_start < 0) seg_start = 0;
+	if (seg_end >= dev->_width) seg_end = dev->_width - 1;
+	if (seg_start > seg_end) return;
+	PAGE_t * p = &dev->_page[page];
+	if (seg_start < p->_dirtyStart) p->_dirtyStart = seg_start;
+	if (seg_end > p->_dirtyEnd) p->_dirtyEnd = seg_end;
+}
+
+// Return the dirty column range of a page and mark it clean
+bool ssd1306_take_dirty(SSD1306_t * dev, int page, int * seg_start, int * seg_end)
+{
+	PAGE_t * p = &dev->_page[page];
+	if (p->_dirtyStart > p->_dirtyEnd) return false;
+	*seg_start = p->_dirtyStart;
+	*seg_end = p->_dirtyEnd;
+	ssd1306_clean_page(dev, page);
+	return true;
+}
+
+// Force the next ssd1306_show_buffer() to send the whole buffer
+void ssd1306_invalidate(SSD1306_t * dev)
+{
+	for (int page=0; page<dev->_pages;page++) {
+		ssd1306_mark_dirty(dev, page, 0, dev->_width - 1);
+	}
+}
+
+uint32_t ssd1306_get_flush_bytes(SSD1306_t * dev)
+{
+	return dev->_flushBytes;
 }
 
 void ssd1306_set_buffer(SSD1306_t * dev, const uint8_t * buffer)
@@ -61,6 +264,7 @@ void ssd1306_set_buffer(SSD1306_t * dev, const uint8_t * buffer)
 	int index = 0;
 	for (int page=0; page<dev->_pages;page++) {
 		memcpy(&dev->_page[page]._segs, &buffer[index], 128);
+		ssd1306_mark_dirty(dev, page, 0, 127);
 		index = index + 128;
 	}
 }
@@ -77,6 +281,7 @@ void ssd1306_get_buffer(SSD1306_t * dev, uint8_t * buffer)
 void ssd1306_set_page(SSD1306_t * dev, int page, const uint8_t * buffer)
 {
 	memcpy(&dev->_page[page]._segs, buffer, 128);
+	ssd1306_mark_dirty(dev, page, 0, 127);
 }
 
 void ssd1306_get_page(SSD1306_t * dev, int page, uint8_t * buffer)
@@ -86,30 +291,33 @@ void ssd1306_get_page(SSD1306_t * dev, int page, uint8_t * buffer)
 
 void ssd1306_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width)
 {
-	if (dev->_address == SPI_ADDRESS) {
-		spi_display_image(dev, page, seg, images, width);
-	} else {
-		i2c_display_image(dev, page, seg, images, width);
-	}
+	ssd1306_panel_image(dev, page, seg, images, width);
 	// Set to internal buffer
 	memcpy(&dev->_page[page]._segs[seg], images, width);
+	ssd1306_page_sent(dev, page, seg, width);
 }
 
 void ssd1306_display_text(SSD1306_t * dev, int page, const char * text, int text_len, bool invert)
+{
+	ssd1306_display_text_at(dev, page, 0, text, text_len, invert);
+}
+
+// Text starting at any column; characters past the right edge are dropped
+void ssd1306_display_text_at(SSD1306_t * dev, int page, int seg, const char * text, int text_len, bool invert)
 {
 	if (page >= dev->_pages) return;
+	if (seg < 0 || seg >= dev->_width) return;
 	int _text_len = text_len;
-	if (_text_len > 16) _text_len = 16;
+	if (_text_len > (dev->_width - seg) / 8) _text_len = (dev->_width - seg) / 8;
+	if (_text_len <= 0) return;
 
-	int seg = 0;
-	uint8_t image[8];
+	// Render the whole line first and send it as a single data transfer
+	const uint8_t (*font)[8] = ssd1306_font(dev, invert);
+	uint8_t image[128];
 	for (int i = 0; i < _text_len; i++) {
-		memcpy(image, font8x8_basic_tr[(uint8_t)text[i]], 8);
-		if (invert) ssd1306_invert(image, 8);
-		if (dev->_flip) ssd1306_flip(image, 8);
-		ssd1306_display_image(dev, page, seg, image, 8);
-		seg = seg + 8;
+		memcpy(&image[i*8], font[(uint8_t)text[i]], 8);
 	}
+	ssd1306_display_image(dev, page, seg, image, _text_len * 8);
 }
 
 void ssd1306_display_text_box1(SSD1306_t * dev, int page, int seg, const char * text, int box_width, int text_len, bool invert, int delay)
@@ -118,28 +326,23 @@ void ssd1306_display_text_box1(SSD1306_t * dev, int page, int seg, const char *
 	int text_box_pixel = box_width * 8;
 	if (seg + text_box_pixel > dev->_width) return;
 
-	int _seg = seg;
-	uint8_t image[8];
+	const uint8_t (*font)[8] = ssd1306_font(dev, invert);
+	uint8_t image[128];
 	for (int i = 0; i < box_width; i++) {
-		memcpy(image, font8x8_basic_tr[(uint8_t)text[i]], 8);
-		if (invert) ssd1306_invert(image, 8);
-		if (dev->_flip) ssd1306_flip(image, 8);
-		ssd1306_display_image(dev, page, _seg, image, 8);
-		_seg = _seg + 8;
+		memcpy(&image[i*8], font[(uint8_t)text[i]], 8);
 	}
+	ssd1306_display_image(dev, page, seg, image, text_box_pixel);
 	vTaskDelay(delay);
 
 	// Horizontally scroll inside the box
 	for (int _text=box_width;_text<text_len;_text++) {
-		memcpy(image, font8x8_basic_tr[(uint8_t)text[_text]], 8);
-		if (invert) ssd1306_invert(image, 8);
-		if (dev->_flip) ssd1306_flip(image, 8);
+		const uint8_t * glyph = font[(uint8_t)text[_text]];
 		for (int _bit=0;_bit<8;_bit++) {
 			for (int _pixel=0;_pixel<text_box_pixel;_pixel++) {
 				//ESP_LOGI(__FUNCTION__, "_text=%d _bit=%d _pixel=%d", _text, _bit, _pixel);
 				dev->_page[page]._segs[_pixel+seg] = dev->_page[page]._segs[_pixel+seg+1];
 			}
-			dev->_page[page]._segs[seg+text_box_pixel-1] = image[_bit];
+			dev->_page[page]._segs[seg+text_box_pixel-1] = glyph[_bit];
 			ssd1306_display_image(dev, page, seg, &dev->_page[page]._segs[seg], text_box_pixel);
 			vTaskDelay(delay);
 		}
@@ -152,31 +355,25 @@ void ssd1306_display_text_box2(SSD1306_t * dev, int page, int seg, const char *
 	int text_box_pixel = box_width * 8;
 	if (seg + text_box_pixel > dev->_width) return;
 
-	int _seg = seg;
-	uint8_t image[8];
+	const uint8_t (*font)[8] = ssd1306_font(dev, invert);
+	uint8_t image[128];
 
 	// Fill the text box with blanks
 	for (int i = 0; i < box_width; i++) {
-		//memcpy(image, font8x8_basic_tr[(uint8_t)text[i]], 8);
-		memcpy(image, font8x8_basic_tr[0x20], 8);
-		if (invert) ssd1306_invert(image, 8);
-		if (dev->_flip) ssd1306_flip(image, 8);
-		ssd1306_display_image(dev, page, _seg, image, 8);
-		_seg = _seg + 8;
+		memcpy(&image[i*8], font[0x20], 8);
 	}
+	ssd1306_display_image(dev, page, seg, image, text_box_pixel);
 	vTaskDelay(delay);
 
 	// Horizontally scroll inside the box
 	for (int _text=0;_text<text_len;_text++) {
-		memcpy(image, font8x8_basic_tr[(uint8_t)text[_text]], 8);
-		if (invert) ssd1306_invert(image, 8);
-		if (dev->_flip) ssd1306_flip(image, 8);
+		const uint8_t * glyph = font[(uint8_t)text[_text]];
 		for (int _bit=0;_bit<8;_bit++) {
 			for (int _pixel=0;_pixel<text_box_pixel;_pixel++) {
 				//ESP_LOGI(__FUNCTION__, "_text=%d _bit=%d _pixel=%d", _text, _bit, _pixel);
 				dev->_page[page]._segs[_pixel+seg] = dev->_page[page]._segs[_pixel+seg+1];
 			}
-			dev->_page[page]._segs[seg+text_box_pixel-1] = image[_bit];
+			dev->_page[page]._segs[seg+text_box_pixel-1] = glyph[_bit];
 			ssd1306_display_image(dev, page, seg, &dev->_page[page]._segs[seg], text_box_pixel);
 			vTaskDelay(delay);
 		}
@@ -184,15 +381,13 @@ void ssd1306_display_text_box2(SSD1306_t * dev, int page, int seg, const char *
 
 	// Horizontally scroll inside the box
 	for (int _text=0;_text<box_width;_text++) {
-		memcpy(image, font8x8_basic_tr[0x20], 8);
-		if (invert) ssd1306_invert(image, 8);
-		if (dev->_flip) ssd1306_flip(image, 8);
+		const uint8_t * glyph = font[0x20];
 		for (int _bit=0;_bit<8;_bit++) {
 			for (int _pixel=0;_pixel<text_box_pixel;_pixel++) {
 				//ESP_LOGI(__FUNCTION__, "_text=%d _bit=%d _pixel=%d", _text, _bit, _pixel);
 				dev->_page[page]._segs[_pixel+seg] = dev->_page[page]._segs[_pixel+seg+1];
 			}
-			dev->_page[page]._segs[seg+text_box_pixel-1] = image[_bit];
+			dev->_page[page]._segs[seg+text_box_pixel-1] = glyph[_bit];
 			ssd1306_display_image(dev, page, seg, &dev->_page[page]._segs[seg], text_box_pixel);
 			vTaskDelay(delay);
 		}
@@ -200,54 +395,65 @@ void ssd1306_display_text_box2(SSD1306_t * dev, int page, int seg, const char *
 }
 
 // by Coert Vonk
-void 
-ssd1306_display_text_x3(SSD1306_t * dev, int page, const char * text, int text_len, bool invert)
+// Scale a glyph 3x and store it in the cache slot of its code
+static const x3_glyph_t * ssd1306_x3_glyph(uint8_t code, uint8_t variant)
 {
-	if (page >= dev->_pages) return;
-	int _text_len = text_len;
-	if (_text_len > 5) _text_len = 5;
+	x3_glyph_t * glyph = &x3_cache[code % X3_CACHE_SIZE];
+	if (glyph->_valid && glyph->_code == code && glyph->_variant == variant) return glyph;
 
-	int seg = 0;
+	uint8_t const * const in_columns = font8x8_basic_tr[code];
 
-	for (int nn = 0; nn < _text_len; nn++) {
+	// make the character 3x as high
+	out_column_t out_columns[8];
+	memset(out_columns, 0, sizeof(out_columns));
 
-		uint8_t const * const in_columns = font8x8_basic_tr[(uint8_t)text[nn]];
+	for (int xx = 0; xx < 8; xx++) { // for each column (x-direction)
 
-		// make the character 3x as high
-		out_column_t out_columns[8];
-		memset(out_columns, 0, sizeof(out_columns));
+		uint32_t in_bitmask = 0b1;
+		uint32_t out_bitmask = 0b111;
 
+		for (int yy = 0; yy < 8; yy++) { // for pixel (y-direction)
+			if (in_columns[xx] & in_bitmask) {
+				out_columns[xx].u32 |= out_bitmask;
+			}
+			in_bitmask <<= 1;
+			out_bitmask <<= 3;
+		}
+	}
+
+	// render character in 8 column high pieces, making them 3x as wide
+	for (int yy = 0; yy < 3; yy++)	{ // for each group of 8 pixels high (y-direction)
+		uint8_t * image = glyph->_image[yy];
 		for (int xx = 0; xx < 8; xx++) { // for each column (x-direction)
+			image[xx*3+0] = 
+			image[xx*3+1] = 
+			image[xx*3+2] = out_columns[xx].u8[yy];
+		}
+		if (variant & FONT8X8_INVERT) ssd1306_invert(image, 24);
+		if (variant & FONT8X8_FLIP) ssd1306_flip(image, 24);
+	}
+	glyph->_code = code;
+	glyph->_variant = variant;
+	glyph->_valid = true;
+	return glyph;
+}
 
-			uint32_t in_bitmask = 0b1;
-			uint32_t out_bitmask = 0b111;
+void 
+ssd1306_display_text_x3(SSD1306_t * dev, int page, const char * text, int text_len, bool invert)
+{
+	if (page >= dev->_pages) return;
+	int _text_len = text_len;
+	if (_text_len > 5) _text_len = 5;
 
-			for (int yy = 0; yy < 8; yy++) { // for pixel (y-direction)
-				if (in_columns[xx] & in_bitmask) {
-					out_columns[xx].u32 |= out_bitmask;
-				}
-				in_bitmask <<= 1;
-				out_bitmask <<= 3;
-			}
-		}
+	int seg = 0;
 
-		// render character in 8 column high pieces, making them 3x as wide
+	uint8_t variant = (invert ? FONT8X8_INVERT : 0) | (dev->_flip ? FONT8X8_FLIP : 0);
+	for (int nn = 0; nn < _text_len; nn++) {
+		const x3_glyph_t * glyph = ssd1306_x3_glyph((uint8_t)text[nn], variant);
 		for (int yy = 0; yy < 3; yy++)	{ // for each group of 8 pixels high (y-direction)
-
-			uint8_t image[24];
-			for (int xx = 0; xx < 8; xx++) { // for each column (x-direction)
-				image[xx*3+0] = 
-				image[xx*3+1] = 
-				image[xx*3+2] = out_columns[xx].u8[yy];
-			}
-			if (invert) ssd1306_invert(image, 24);
-			if (dev->_flip) ssd1306_flip(image, 24);
-			if (dev->_address == SPI_ADDRESS) {
-				spi_display_image(dev, page+yy, seg, image, 24);
-			} else {
-				i2c_display_image(dev, page+yy, seg, image, 24);
-			}
-			memcpy(&dev->_page[page+yy]._segs[seg], image, 24);
+			ssd1306_panel_image(dev, page+yy, seg, glyph->_image[yy], 24);
+			memcpy(&dev->_page[page+yy]._segs[seg], glyph->_image[yy], 24);
+			ssd1306_page_sent(dev, page+yy, seg, 24);
 		}
 		seg = seg + 24;
 	}
@@ -271,10 +477,15 @@ void ssd1306_clear_line(SSD1306_t * dev, int page, bool invert)
 
 void ssd1306_contrast(SSD1306_t * dev, int contrast)
 {
-	if (dev->_address == SPI_ADDRESS) {
+	if (dev->_address == OFFSCREEN_ADDRESS) return;
+	if (dev->_address == FRAMEBUFFER_ADDRESS) {
+		fb_contrast(dev, contrast);
+#if !CONFIG_IDF_TARGET_LINUX
+	} else if (dev->_address == SPI_ADDRESS) {
 		spi_contrast(dev, contrast);
 	} else {
 		i2c_contrast(dev, contrast);
+#endif
 	}
 }
 
@@ -300,13 +511,6 @@ void ssd1306_scroll_text(SSD1306_t * dev, const char * text, int text_len, bool
 	ESP_LOGD(__FUNCTION__, "dev->_scEnable=%d", dev->_scEnable);
 	if (dev->_scEnable == false) return;
 
-	void (*func)(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
-	if (dev->_address == SPI_ADDRESS) {
-		func = spi_display_image;
-	} else {
-		func = i2c_display_image;
-	}
-
 	int srcIndex = dev->_scEnd - dev->_scDirection;
 	while(1) {
 		int dstIndex = srcIndex + dev->_scDirection;
@@ -314,7 +518,8 @@ void ssd1306_scroll_text(SSD1306_t * dev, const char * text, int text_len, bool
 		for(int seg = 0; seg < dev->_width; seg++) {
 			dev->_page[dstIndex]._segs[seg] = dev->_page[srcIndex]._segs[seg];
 		}
-		(*func)(dev, dstIndex, 0, dev->_page[dstIndex]._segs, sizeof(dev->_page[dstIndex]._segs));
+		ssd1306_panel_image(dev, dstIndex, 0, dev->_page[dstIndex]._segs, sizeof(dev->_page[dstIndex]._segs));
+		ssd1306_page_sent(dev, dstIndex, 0, sizeof(dev->_page[dstIndex]._segs));
 		if (srcIndex == dev->_scStart) break;
 		srcIndex = srcIndex - dev->_scDirection;
 	}
@@ -343,17 +548,206 @@ void ssd1306_scroll_clear(SSD1306_t * dev)
 
 void ssd1306_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll)
 {
-	if (dev->_address == SPI_ADDRESS) {
+	if (dev->_address == OFFSCREEN_ADDRESS) return;
+	if (dev->_address == FRAMEBUFFER_ADDRESS) {
+		fb_hardware_scroll(dev, scroll);
+#if !CONFIG_IDF_TARGET_LINUX
+	} else if (dev->_address == SPI_ADDRESS) {
 		spi_hardware_scroll(dev, scroll);
 	} else {
 		i2c_hardware_scroll(dev, scroll);
+#endif
 	}
 }
 
-// delay = 0 : display with no wait
-// delay > 0 : display with wait
-// delay < 0 : no display
-void ssd1306_wrap_arround(SSD1306_t * dev, ssd1306_scroll_type_t scroll, int start, int end, int8_t delay)
+// Move a buffer rectangle count columns towards seg_start. The columns freed
+// on the right keep their old bytes until they are redrawn, and are dirty
+// whatever the panel leaves there. Pending dirty bytes inside the rectangle
+// moved too, so then the whole row of it is dirty. With resend the panel
+// GDDRAM does not move: each row is dirty from the first column whose byte
+// changes, which for a flat chart history is little more than the new columns.
+static void ssd1306_shift_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end, int count, bool resend)
+{
+	int width = seg_end - seg_start + 1;
+	if (count > width) count = width;
+	for (int page=page_start;page<=page_end;page++) {
+		PAGE_t * p = &dev->_page[page];
+		int first = seg_end - count + 1;
+		if (resend) {
+			for (int seg=seg_start;seg<seg_end-count+1;seg++) {
+				if (p->_segs[seg] != p->_segs[seg + count]) {
+					first = seg;
+					break;
+				}
+			}
+		}
+		memmove(&p->_segs[seg_start], &p->_segs[seg_start + count], width - count);
+		if (p->_dirtyStart <= seg_end && p->_dirtyEnd >= seg_start) {
+			ssd1306_mark_dirty(dev, page, seg_start, seg_end);
+		} else {
+			ssd1306_mark_dirty(dev, page, first, seg_end);
+		}
+	}
+}
+
+// Scroll a rectangle of the buffer and of the panel count columns left.
+// With CONFIG_CONTENT_SCROLL a panel moves its own GDDRAM with one content
+// scroll command, so none of the shifted bytes cross the bus again; only the new columns are sent by
+// the next ssd1306_show_buffer(). Without it (plain SSD1306) the next
+// ssd1306_show_buffer() resends each row from the first column that changed
+// to seg_end: the new columns on a flat history, the whole rectangle on a
+// busy one. An offscreen buffer records the scroll
+// for ssd1306_take_column_scroll() (the render task replays it).
+void ssd1306_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end, int count)
+{
+	if (page_start < 0) page_start = 0;
+	if (page_end >= dev->_pages) page_end = dev->_pages - 1;
+	if (seg_start < 0) seg_start = 0;
+	if (seg_end >= dev->_width) seg_end = dev->_width - 1;
+	if (page_start > page_end || seg_start >= seg_end || count <= 0) return;
+
+	if (dev->_address == OFFSCREEN_ADDRESS) {
+		COLUMN_SCROLL_t * s = &dev->_colScroll;
+		if (s->_count != 0 && (s->_pageStart != page_start || s->_pageEnd != page_end || s->_segStart != seg_start || s->_segEnd != seg_end)) {
+			// Only one region is tracked: resend this one
+			ssd1306_shift_columns(dev, page_start, page_end, seg_start, seg_end, count, true);
+			return;
+		}
+		ssd1306_shift_columns(dev, page_start, page_end, seg_start, seg_end, count, false);
+		if (s->_count == 0) {
+			s->_pageStart = page_start;
+			s->_pageEnd = page_end;
+			s->_segStart = seg_start;
+			s->_segEnd = seg_end;
+		}
+		s->_count += count;
+		return;
+	}
+
+#if CONFIG_CONTENT_SCROLL
+	// Back-to-back content scrolls need two frames in between: resend instead
+	bool resend = (count > 1);
+#else
+	// Not every controller has the content scroll command: resend the columns
+	bool resend = true;
+#endif
+	ssd1306_shift_columns(dev, page_start, page_end, seg_start, seg_end, count, resend);
+	if (resend) return;
+
+	if (dev->_address == FRAMEBUFFER_ADDRESS) {
+		fb_scroll_columns(dev, page_start, page_end, seg_start, seg_end);
+#if !CONFIG_IDF_TARGET_LINUX
+	} else if (dev->_address == SPI_ADDRESS) {
+		spi_scroll_columns(dev, page_start, page_end, seg_start, seg_end);
+	} else {
+		i2c_scroll_columns(dev, page_start, page_end, seg_start, seg_end);
+#endif
+	}
+}
+
+// Pending column scroll of an offscreen buffer; clears it
+bool ssd1306_take_column_scroll(SSD1306_t * dev, COLUMN_SCROLL_t * scroll)
+{
+	if (dev->_colScroll._count == 0) return false;
+	*scroll = dev->_colScroll;
+	dev->_colScroll._count = 0;
+	return true;
+}
+
+// Shift one page of segs[start..end] one pixel vertically, four columns per
+// 32-bit word. Every byte moves one bit towards the LSB (or the MSB) and takes
+// the bit that leaves the same column of the neighbouring page.
+static void ssd1306_shift_page_bits(uint8_t * segs, const uint8_t * carry, int start, int end, bool towards_lsb)
+{
+	int seg = start;
+	for (;seg+4<=end+1;seg+=4) {
+		uint32_t wk, in;
+		memcpy(&wk, &segs[seg], 4);
+		memcpy(&in, &carry[seg], 4);
+		if (towards_lsb) {
+			wk = ((wk >> 1) & 0x7F7F7F7F) | ((in & 0x01010101) << 7);
+		} else {
+			wk = ((wk << 1) & 0xFEFEFEFE) | ((in >> 7) & 0x01010101);
+		}
+		memcpy(&segs[seg], &wk, 4);
+	}
+	for (;seg<=end;seg++) {
+		if (towards_lsb) {
+			segs[seg] = (segs[seg] >> 1) | (carry[seg] << 7);
+		} else {
+			segs[seg] = (segs[seg] << 1) | (carry[seg] >> 7);
+		}
+	}
+}
+
+// Wrap-around scroll of the internal buffer by one pixel or one page.
+// Horizontal scrolls move each page with memmove; vertical scrolls shift
+// each page four columns at a time instead of byte by byte.
+static void ssd1306_scroll_buffer(SSD1306_t * dev, ssd1306_scroll_type_t scroll, int start, int end)
+{
+	if (scroll == SCROLL_RIGHT || scroll == SCROLL_LEFT) {
+		int _start = start; // 0 to 7
+		int _end = end; // 0 to 7
+		if (_end >= dev->_pages) _end = dev->_pages - 1;
+		for (int page=_start;page<=_end;page++) {
+			uint8_t * segs = dev->_page[page]._segs;
+			if (scroll == SCROLL_RIGHT) {
+				uint8_t wk = segs[127];
+				memmove(&segs[1], &segs[0], 127);
+				segs[0] = wk;
+			} else {
+				uint8_t wk = segs[0];
+				memmove(&segs[0], &segs[1], 127);
+				segs[127] = wk;
+			}
+		}
+
+	} else if (scroll == SCROLL_UP || scroll == SCROLL_DOWN) {
+		int _start = start; // 0 to {width-1}
+		int _end = end; // 0 to {width-1}
+		if (_end >= dev->_width) _end = dev->_width - 1;
+		// A flipped page holds bit-reversed bytes: the same move is the
+		// opposite shift, so no byte has to be reversed
+		bool towards_lsb = (scroll == SCROLL_UP) != dev->_flip;
+		int last = dev->_pages - 1;
+		uint8_t save[128];
+		if (scroll == SCROLL_UP) {
+			// Each page takes its new bottom row from the top row of the page below
+			memcpy(save, dev->_page[0]._segs, 128);
+			for (int page=0;page<last;page++) {
+				ssd1306_shift_page_bits(dev->_page[page]._segs, dev->_page[page+1]._segs, _start, _end, towards_lsb);
+			}
+			ssd1306_shift_page_bits(dev->_page[last]._segs, save, _start, _end, towards_lsb);
+		} else {
+			memcpy(save, dev->_page[last]._segs, 128);
+			for (int page=last;page>0;page--) {
+				ssd1306_shift_page_bits(dev->_page[page]._segs, dev->_page[page-1]._segs, _start, _end, towards_lsb);
+			}
+			ssd1306_shift_page_bits(dev->_page[0]._segs, save, _start, _end, towards_lsb);
+		}
+
+	} else if (scroll == PAGE_SCROLL_DOWN || scroll == PAGE_SCROLL_UP) {
+		uint8_t save[128];
+		int last = dev->_pages - 1;
+		if (scroll == PAGE_SCROLL_DOWN) {
+			memcpy(save, dev->_page[last]._segs, 128);
+			for (int page=last;page>0;page--) {
+				memcpy(dev->_page[page]._segs, dev->_page[page-1]._segs, 128);
+			}
+			memcpy(dev->_page[0]._segs, save, 128);
+		} else {
+			memcpy(save, dev->_page[0]._segs, 128);
+			for (int page=0;page<last;page++) {
+				memcpy(dev->_page[page]._segs, dev->_page[page+1]._segs, 128);
+			}
+			memcpy(dev->_page[last]._segs, save, 128);
+		}
+	}
+}
+
+#if CONFIG_SCROLL_BENCHMARK
+// Original byte-by-byte kernels, kept as the reference for the benchmark
+static void ssd1306_scroll_bytewise(SSD1306_t * dev, ssd1306_scroll_type_t scroll, int start, int end)
 {
 	if (scroll == SCROLL_RIGHT) {
 		int _start = start; // 0 to 7
@@ -517,20 +911,67 @@ void ssd1306_wrap_arround(SSD1306_t * dev, ssd1306_scroll_type_t scroll, int sta
 			dev->_page[dev->_pages-1]._segs[seg] = save[seg];
 		}
 	}
+}
+#endif
+
+// delay = 0 : display with no wait
+// delay > 0 : display with wait
+// delay < 0 : no display
+void ssd1306_wrap_arround(SSD1306_t * dev, ssd1306_scroll_type_t scroll, int start, int end, int8_t delay)
+{
+	ssd1306_scroll_buffer(dev, scroll, start, end);
 
+	ssd1306_invalidate(dev);
 	if (delay >= 0) {
 		for (int page=0;page<dev->_pages;page++) {
-			if (dev->_address == SPI_ADDRESS) {
-				spi_display_image(dev, page, 0, dev->_page[page]._segs, 128);
-			} else {
-				i2c_display_image(dev, page, 0, dev->_page[page]._segs, 128);
-			}
+			ssd1306_panel_image(dev, page, 0, dev->_page[page]._segs, 128);
+			ssd1306_page_sent(dev, page, 0, 128);
 			if (delay) vTaskDelay(delay);
 		}
 	}
 
 }
 
+// Bit-reversed value of every byte, for flips
+#define R2(n) n, n + 2*64, n + 1*64, n + 3*64
+#define R4(n) R2(n), R2(n + 2*16), R2(n + 1*16), R2(n + 3*16)
+#define R6(n) R4(n), R4(n + 2*4), R4(n + 1*4), R4(n + 3*4)
+static const uint8_t ssd1306_reverse_table[256] = { R6(0), R6(2), R6(1), R6(3) };
+#undef R2
+#undef R4
+#undef R6
+
+// Transpose an 8x8 bit matrix held in one word (byte i = row i, bit j =
+// column j): bit 8*i+j moves to 8*j+i. Three mask-and-shift butterfly steps
+// swap 1x1, 2x2 and 4x4 blocks.
+uint64_t ssd1306_transpose8(uint64_t x)
+{
+	uint64_t t;
+	t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+	x = x ^ t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+	x = x ^ t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+	x = x ^ t ^ (t << 28);
+	return x;
+}
+
+// Replace the bits of mask in one buffer byte; out-of-range bytes are dropped
+static void ssd1306_merge_byte(SSD1306_t * dev, int page, int seg, uint8_t bits, uint8_t mask)
+{
+	if (mask == 0 || page < 0 || page >= dev->_pages || seg < 0) return;
+	if (dev->_flip) {
+		bits = ssd1306_rotate_byte(bits);
+		mask = ssd1306_rotate_byte(mask);
+	}
+	uint8_t * wk = &dev->_page[page]._segs[seg];
+	*wk = (*wk & ~mask) | (bits & mask);
+}
+
+// Each 8x8 block of the bitmap (8 rows of one byte) is transposed into 8
+// column bytes, which are then shifted across the page boundary and merged
+// with a mask (two bytes per column and band instead of a read-modify-write
+// per pixel).
 void _ssd1306_bitmaps(SSD1306_t * dev, int xpos, int ypos, const uint8_t * bitmap, int width, int height, bool invert)
 {
 	if ( (width % 8) != 0) {
@@ -538,62 +979,36 @@ void _ssd1306_bitmaps(SSD1306_t * dev, int xpos, int ypos, const uint8_t * bitma
 		return;
 	}
 	int _width = width / 8;
-	uint8_t wk0;
-	uint8_t wk1;
-	uint8_t wk2;
-	uint8_t page = (ypos / 8);
-	uint8_t _seg = xpos;
-	uint8_t dstBits = (ypos % 8);
+	int page = (ypos / 8);
+	int dstBits = (ypos % 8);
 	ESP_LOGD(__FUNCTION__, "_width=%d ypos=%d page=%d dstBits=%d", _width, ypos, page, dstBits);
-	int offset = 0;
-	for(int _height=0;_height<height;_height++) {
-		for (int index=0;index<_width;index++) {
-			for (int srcBits=7; srcBits>=0; srcBits--) {
-				wk0 = dev->_page[page]._segs[_seg];
-				if (dev->_flip) wk0 = ssd1306_rotate_byte(wk0);
-
-				wk1 = bitmap[index+offset];
-				if (invert) wk1 = ~wk1;
-
-				//wk2 = ssd1306_copy_bit(bitmap[index+offset], srcBits, wk0, dstBits);
-				wk2 = ssd1306_copy_bit(wk1, srcBits, wk0, dstBits);
-				if (dev->_flip) wk2 = ssd1306_rotate_byte(wk2);
-
-				ESP_LOGD(__FUNCTION__, "index=%d offset=%d wk1=0x%x page=%d _seg=%d, wk2=%02x", index, offset, wk1, page, _seg, wk2);
-				if (_seg >= 128) {
-					ESP_LOGW(__FUNCTION__, "segment is out of range");
-					break;
-				}
-				if (page >= dev->_pages) {
-					ESP_LOGW(__FUNCTION__, "page is out of range");
-					break;
-				}
-				dev->_page[page]._segs[_seg] = wk2;
-				_seg++;
+	for (int row=0;row<height;row+=8,page++) {
+		int rows = height - row;
+		if (rows > 8) rows = 8;
+		uint16_t mask = (0xFF >> (8 - rows)) << dstBits;
+		const uint8_t * src = &bitmap[row * _width];
+		for (int index=0;index<_width && xpos + index * 8 < dev->_width;index++) {
+			uint64_t block = 0;
+			for (int r=0;r<rows;r++) {
+				uint8_t wk = src[r * _width + index];
+				if (invert) wk = ~wk;
+				block |= (uint64_t)wk << (r * 8);
+			}
+			// Byte 7-c of the transpose is column c (the MSB is the leftmost pixel)
+			block = ssd1306_transpose8(block);
+			for (int c=0;c<8;c++) {
+				int seg = xpos + index * 8 + c;
+				if (seg >= dev->_width) break;
+				uint16_t wk2 = (uint8_t)(block >> ((7 - c) * 8)) << dstBits;
+				ssd1306_merge_byte(dev, page, seg, wk2, mask);
+				ssd1306_merge_byte(dev, page + 1, seg, wk2 >> 8, mask >> 8);
 			}
 		}
-		//vTaskDelay(1);
-		offset = offset + _width;
-		dstBits++;
-		_seg = xpos;
-		if (dstBits == 8) {
-			page++;
-			dstBits=0;
-		}
+		ssd1306_mark_dirty(dev, page, xpos, xpos + width - 1);
+		if (mask >> 8) ssd1306_mark_dirty(dev, page + 1, xpos, xpos + width - 1);
 	}
-
-#if 0
-	for (int _seg=ypos;_seg<ypos+width;_seg++) {
-		ssd1306_dump_page(dev, page-1, _seg);
-	}
-	for (int _seg=ypos;_seg<ypos+width;_seg++) {
-		ssd1306_dump_page(dev, page, _seg);
-	}
-#endif
-	//ssd1306_show_buffer(dev);
 }
 
-
 void ssd1306_bitmaps(SSD1306_t * dev, int xpos, int ypos, const uint8_t * bitmap, int width, int height, bool invert)
 {
 	_ssd1306_bitmaps(dev, xpos, ypos, bitmap, width, height, invert);
@@ -617,20 +1032,72 @@ void ssd1306_bitmaps(SSD1306_t * dev, int xpos, int ypos, const uint8_t * bitmap
 // Set pixel to internal buffer. Not show it.
 void _ssd1306_pixel(SSD1306_t * dev, int xpos, int ypos, bool invert)
 {
+	if (xpos < 0 || xpos >= dev->_width || ypos < 0 || ypos >= dev->_height) return;
 	uint8_t _page = (ypos / 8);
 	uint8_t _bits = (ypos % 8);
 	uint8_t _seg = xpos;
 	uint8_t wk0 = dev->_page[_page]._segs[_seg];
 	uint8_t wk1 = 1 << _bits;
+	// The buffer holds flipped bytes: flip the mask, not the content
+	if (dev->_flip) wk1 = ssd1306_rotate_byte(wk1);
 	ESP_LOGD(__FUNCTION__, "ypos=%d _page=%d _bits=%d wk0=0x%02x wk1=0x%02x", ypos, _page, _bits, wk0, wk1);
 	if (invert) {
 		wk0 = wk0 & ~wk1;
 	} else {
 		wk0 = wk0 | wk1;
 	}
-	if (dev->_flip) wk0 = ssd1306_rotate_byte(wk0);
 	ESP_LOGD(__FUNCTION__, "wk0=0x%02x wk1=0x%02x", wk0, wk1);
 	dev->_page[_page]._segs[_seg] = wk0;
+	ssd1306_mark_dirty(dev, _page, _seg, _seg);
+}
+
+// Set (or clear with invert) the same bits in a run of columns of one page
+static void ssd1306_fill_span(SSD1306_t * dev, int page, int seg_start, int seg_end, uint8_t mask, bool invert)
+{
+	if (page < 0 || page >= dev->_pages) return;
+	if (seg_start < 0) seg_start = 0;
+	if (seg_end >= dev->_width) seg_end = dev->_width - 1;
+	if (seg_start > seg_end) return;
+	if (dev->_flip) mask = ssd1306_rotate_byte(mask);
+	uint8_t * segs = dev->_page[page]._segs;
+	if (mask == 0xFF) {
+		memset(&segs[seg_start], invert ? 0x00 : 0xFF, seg_end - seg_start + 1);
+	} else if (invert) {
+		for (int seg=seg_start;seg<=seg_end;seg++) segs[seg] &= ~mask;
+	} else {
+		for (int seg=seg_start;seg<=seg_end;seg++) segs[seg] |= mask;
+	}
+	ssd1306_mark_dirty(dev, page, seg_start, seg_end);
+}
+
+// Fill rectangle to internal buffer: one masked span per page. Not show it.
+void _ssd1306_fill_rect(SSD1306_t * dev, int x1, int y1, int x2, int y2, bool invert)
+{
+	if (x1 > x2) { int wk = x1; x1 = x2; x2 = wk; }
+	if (y1 > y2) { int wk = y1; y1 = y2; y2 = wk; }
+	if (y1 < 0) y1 = 0;
+	if (y2 >= dev->_height) y2 = dev->_height - 1;
+	if (y1 > y2) return;
+	int page_start = y1 / 8;
+	int page_end = y2 / 8;
+	for (int page=page_start;page<=page_end;page++) {
+		uint8_t mask = 0xFF;
+		if (page == page_start) mask &= 0xFF << (y1 % 8);
+		if (page == page_end) mask &= 0xFF >> (7 - (y2 % 8));
+		ssd1306_fill_span(dev, page, x1, x2, mask, invert);
+	}
+}
+
+// Set horizontal line to internal buffer. Not show it.
+void _ssd1306_hline(SSD1306_t * dev, int x1, int x2, int y, bool invert)
+{
+	_ssd1306_fill_rect(dev, x1, y, x2, y, invert);
+}
+
+// Set vertical line to internal buffer. Not show it.
+void _ssd1306_vline(SSD1306_t * dev, int x, int y1, int y2, bool invert)
+{
+	_ssd1306_fill_rect(dev, x, y1, x, y2, invert);
 }
 
 // Set line to internal buffer. Not show it.
@@ -649,26 +1116,36 @@ void _ssd1306_line(SSD1306_t * dev, int x1, int y1, int x2, int y2,  bool invert
 	sx = ( x2 > x1 ) ? 1 : -1;
 	sy = ( y2 > y1 ) ? 1 : -1;
 
-	/* inclination < 1 */
+	/* inclination < 1: pixels with the same y go out as one horizontal span */
 	if ( dx > dy ) {
 		E = -dx;
+		int run = x1;
 		for ( i = 0 ; i <= dx ; i++ ) {
-			_ssd1306_pixel(dev, x1, y1, invert);
+			int x = x1;
 			x1 += sx;
 			E += 2 * dy;
+			if ( E >= 0 || i == dx ) {
+				_ssd1306_hline(dev, run, x, y1, invert);
+				run = x1;
+			}
 			if ( E >= 0 ) {
-			y1 += sy;
-			E -= 2 * dx;
+				y1 += sy;
+				E -= 2 * dx;
+			}
 		}
-	}
 
-	/* inclination >= 1 */
+	/* inclination >= 1: pixels with the same x go out as one vertical span */
 	} else {
 		E = -dy;
+		int run = y1;
 		for ( i = 0 ; i <= dy ; i++ ) {
-			_ssd1306_pixel(dev, x1, y1, invert);
+			int y = y1;
 			y1 += sy;
 			E += 2 * dx;
+			if ( E >= 0 || i == dy ) {
+				_ssd1306_vline(dev, x1, run, y, invert);
+				run = y1;
+			}
 			if ( E >= 0 ) {
 				x1 += sx;
 				E -= 2 * dy;
@@ -702,7 +1179,7 @@ void _ssd1306_circle(SSD1306_t * dev, int x0, int y0, int r, unsigned int opt, b
 	} while(y<0);
 }
 
-// Draw disc (fill circle)
+// Draw disc (fill circle) as vertical spans
 void _ssd1306_disc(SSD1306_t * dev, int x0, int y0, int r, unsigned int opt, bool invert)
 {
 	int x;
@@ -720,13 +1197,13 @@ void _ssd1306_disc(SSD1306_t * dev, int x0, int y0, int r, unsigned int opt, boo
 			//_ssd1306_line(dev, x0-x, y0-y, x0-x, y0+y, invert);
 			//_ssd1306_line(dev, x0+x, y0-y, x0+x, y0+y, invert);
 			if ((opt & OLED_DRAW_LOWER_LEFT) == OLED_DRAW_LOWER_LEFT)
-				_ssd1306_line(dev, x0-x, y0-y, x0-x, y0, invert);
+				_ssd1306_vline(dev, x0-x, y0-y, y0, invert);
 			if ((opt & OLED_DRAW_UPPER_LEFT) == OLED_DRAW_UPPER_LEFT)
-				_ssd1306_line(dev, x0-x, y0, x0-x, y0+y, invert);
+				_ssd1306_vline(dev, x0-x, y0, y0+y, invert);
 			if ((opt & OLED_DRAW_LOWER_RIGHT) == OLED_DRAW_LOWER_RIGHT)
-				_ssd1306_line(dev, x0+x, y0-y, x0+x, y0, invert);
+				_ssd1306_vline(dev, x0+x, y0-y, y0, invert);
 			if ((opt & OLED_DRAW_UPPER_RIGHT) == OLED_DRAW_UPPER_RIGHT)
-				_ssd1306_line(dev, x0+x, y0, x0+x, y0+y, invert);
+				_ssd1306_vline(dev, x0+x, y0, y0+y, invert);
 
 		} // endif
 		ChangeX=(old_err=err)<=x;
@@ -740,8 +1217,8 @@ void _ssd1306_disc(SSD1306_t * dev, int x0, int y0, int r, unsigned int opt, boo
 // Draw cursor
 void _ssd1306_cursor(SSD1306_t * dev, int x0, int y0, int r, bool invert)
 {
-	_ssd1306_line(dev, x0-r, y0, x0+r, y0, invert);
-	_ssd1306_line(dev, x0, y0-r, x0, y0+r, invert);
+	_ssd1306_hline(dev, x0-r, x0+r, y0, invert);
+	_ssd1306_vline(dev, x0, y0-r, y0+r, invert);
 }
 
 void ssd1306_invert(uint8_t *buf, size_t blen)
@@ -785,24 +1262,12 @@ uint8_t ssd1306_copy_bit(uint8_t src, int srcBits, uint8_t dst, int dstBits)
 // Rotate 8-bit data
 // 0x12-->0x48
 uint8_t ssd1306_rotate_byte(uint8_t ch1) {
-	uint8_t ch2 = 0;
-	for (int j=0;j<8;j++) {
-		ch2 = (ch2 << 1) + (ch1 & 0x01);
-		ch1 = ch1 >> 1;
-	}
-	return ch2;
+	return ssd1306_reverse_table[ch1];
 }
 
 
 void ssd1306_fadeout(SSD1306_t * dev)
 {
-	void (*func)(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
-	if (dev->_address == SPI_ADDRESS) {
-		func = spi_display_image;
-	} else {
-		func = i2c_display_image;
-	}
-
 	uint8_t image[1];
 	for(int page=0; page<dev->_pages; page++) {
 		image[0] = 0xFF;
@@ -813,8 +1278,9 @@ void ssd1306_fadeout(SSD1306_t * dev)
 				image[0] = image[0] << 1;
 			}
 			for(int seg=0; seg<128; seg++) {
-				(*func)(dev, page, seg, image, 1);
+				ssd1306_panel_image(dev, page, seg, image, 1);
 				dev->_page[page]._segs[seg] = image[0];
+				ssd1306_page_sent(dev, page, seg, 1);
 			}
 		}
 	}
@@ -822,7 +1288,23 @@ void ssd1306_fadeout(SSD1306_t * dev)
 
 // Rotate character image
 // Only valid for 8 dots x 8 dots
+// image[i] bit (7-j) = source image[j] bit i: a transpose of the columns in
+// reverse order. With flip every byte is bit-reversed again, which leaves
+// the plain transpose.
 void ssd1306_rotate_image(uint8_t *image, bool flip) {
+	uint64_t block = 0;
+	for (int j=0;j<8;j++) {
+		block |= (uint64_t)image[flip ? j : 7 - j] << (j * 8);
+	}
+	block = ssd1306_transpose8(block);
+	for (int i=0;i<8;i++) {
+		image[i] = block >> (i * 8);
+	}
+}
+
+#if CONFIG_ROTATE_BENCHMARK
+// Original bit-by-bit rotation, kept as the reference for the benchmark
+static void ssd1306_rotate_image_bitwise(uint8_t *image, bool flip) {
 	uint8_t _image[8];
 	uint8_t _smask = 0x01;
 	for (int i=0;i<8;i++) {
@@ -830,7 +1312,6 @@ void ssd1306_rotate_image(uint8_t *image, bool flip) {
 		_image[i] = 0;
 		for (int j=0;j<8;j++) {
 			uint8_t _wk = image[j] & _smask;
-			ESP_LOGD(__FUNCTION__, "image[%d]=0x%x _smask=0x%x _wk=0x%x", j, image[j], _smask, _wk);
 			if (_wk != 0) {
 				_image[i] = _image[i] + _dmask;
 			}
@@ -842,24 +1323,31 @@ void ssd1306_rotate_image(uint8_t *image, bool flip) {
 	for (int i=0;i<8;i++) {
 		image[i] = _image[i];
 	}
-	if (flip) ssd1306_flip(image, 8);
-#if 0
-	for (int i=0;i<8;i++) {
-		ESP_LOGI(__FUNCTION__, "image[%d]=0x%x", i, image[i]);
+	if (flip) {
+		for (int i=0;i<8;i++) {
+			uint8_t ch1 = image[i];
+			uint8_t ch2 = 0;
+			for (int j=0;j<8;j++) {
+				ch2 = (ch2 << 1) + (ch1 & 0x01);
+				ch1 = ch1 >> 1;
+			}
+			image[i] = ch2;
+		}
 	}
-#endif
 }
+#endif
 
 void ssd1306_display_rotate_text(SSD1306_t * dev, int seg, const char * text, int text_len, bool invert) {
 	int _text_len = text_len;
 	if (_text_len > 8) _text_len = 8;
 	uint8_t image[8];
 	int _page = dev->_pages-1;
+	// Inverting commutes with the rotation: take the inverted glyph directly
+	const uint8_t (*font)[8] = font8x8_variants[invert ? FONT8X8_INVERT : 0];
 	for (uint8_t i = 0; i < _text_len; i++) {
-		memcpy(image, font8x8_basic_tr[(uint8_t)text[i]], 8);
+		memcpy(image, font[(uint8_t)text[i]], 8);
 		ssd1306_rotate_image(image, dev->_flip);
 		ESP_LOGD(__FUNCTION__, "_page=%d seg=%d", _page, seg);
-		if (invert) ssd1306_invert(image, 8);
 		ssd1306_display_image(dev, _page, seg, image, 8);
 		_page--;
 		if (_page < 0) return;
@@ -879,3 +1367,125 @@ void ssd1306_dump_page(SSD1306_t * dev, int page, int seg)
 	ESP_LOGI(__FUNCTION__, "dev->_page[%d]._segs[%d]=%02x", page, seg, dev->_page[page]._segs[seg]);
 }
 
+
+#if CONFIG_SCROLL_BENCHMARK
+#define SCROLL_BENCH_FRAMES 16
+
+// Cycles per full-screen scroll frame, word kernels against the byte-wise
+// reference, and a bit-exact check of both on a pseudo-random screen.
+// Returns the number of pages that differ over all scrolls.
+int ssd1306_scroll_benchmark(SSD1306_t * dev)
+{
+	static SSD1306_t fast, ref;
+	static const ssd1306_scroll_type_t types[] = { SCROLL_RIGHT, SCROLL_LEFT, SCROLL_UP, SCROLL_DOWN, PAGE_SCROLL_DOWN, PAGE_SCROLL_UP };
+	static const char * names[] = { "right", "left", "up", "down", "page down", "page up" };
+	int total = 0;
+
+	for (int flip=0;flip<=1;flip++) {
+		ssd1306_init_offscreen(&fast, dev);
+		fast._flip = flip;
+		uint32_t seed = 0x12345678;
+		for (int page=0;page<fast._pages;page++) {
+			for (int seg=0;seg<128;seg++) {
+				seed = seed * 1103515245 + 12345;
+				fast._page[page]._segs[seg] = seed >> 24;
+			}
+		}
+		memcpy(&ref, &fast, sizeof(SSD1306_t));
+
+		for (int t=0;t<sizeof(types)/sizeof(types[0]);t++) {
+			int end = (types[t] == SCROLL_RIGHT || types[t] == SCROLL_LEFT) ? fast._pages - 1 : fast._width - 1;
+
+			uint32_t begin = esp_cpu_get_cycle_count();
+			for (int i=0;i<SCROLL_BENCH_FRAMES;i++) ssd1306_scroll_buffer(&fast, types[t], 0, end);
+			uint32_t fast_cycles = (esp_cpu_get_cycle_count() - begin) / SCROLL_BENCH_FRAMES;
+
+			begin = esp_cpu_get_cycle_count();
+			for (int i=0;i<SCROLL_BENCH_FRAMES;i++) ssd1306_scroll_bytewise(&ref, types[t], 0, end);
+			uint32_t ref_cycles = (esp_cpu_get_cycle_count() - begin) / SCROLL_BENCH_FRAMES;
+
+			int mismatches = 0;
+			for (int page=0;page<fast._pages;page++) {
+				if (memcmp(fast._page[page]._segs, ref._page[page]._segs, 128) != 0) mismatches++;
+			}
+			ESP_LOGI(__FUNCTION__, "scroll %s%s: %"PRIu32" cycles/frame (byte-wise %"PRIu32"), %d pages differ",
+				names[t], flip ? " flip" : "", fast_cycles, ref_cycles, mismatches);
+			total += mismatches;
+		}
+	}
+	return total;
+}
+#endif
+
+#if CONFIG_ROTATE_BENCHMARK
+#define ROTATE_BENCH_ROUNDS 4
+
+// Bit-exact check of the transpose and reverse-table paths against the
+// bit-by-bit versions, then cycles to fill a whole screen with rotated
+// glyphs and with one full-screen bitmap (buffer only, no bus time).
+// Returns the number of bytes and images that differ from the reference.
+int ssd1306_rotate_benchmark(SSD1306_t * dev)
+{
+	static SSD1306_t screen;
+	static uint8_t bitmap[128 / 8 * 64];
+	int mismatches = 0;
+
+	for (int ch=0;ch<256;ch++) {
+		uint8_t ref = 0, wk = ch;
+		for (int j=0;j<8;j++) {
+			ref = (ref << 1) | (wk & 1);
+			wk >>= 1;
+		}
+		if (ssd1306_rotate_byte(ch) != ref) mismatches++;
+	}
+	uint32_t seed = 0x2468ACE1;
+	for (int n=0;n<4096;n++) {
+		uint8_t fast[8], ref[8];
+		for (int i=0;i<8;i++) {
+			seed = seed * 1103515245 + 12345;
+			fast[i] = ref[i] = seed >> 24;
+		}
+		bool flip = n & 1;
+		ssd1306_rotate_image(fast, flip);
+		ssd1306_rotate_image_bitwise(ref, flip);
+		if (memcmp(fast, ref, 8) != 0) mismatches++;
+	}
+	for (int i=0;i<sizeof(bitmap);i++) {
+		seed = seed * 1103515245 + 12345;
+		bitmap[i] = seed >> 24;
+	}
+
+	ssd1306_init_offscreen(&screen, dev);
+	int glyphs = (screen._width / 8) * screen._pages;
+
+	uint32_t begin = esp_cpu_get_cycle_count();
+	for (int round=0;round<ROTATE_BENCH_ROUNDS;round++) {
+		for (int g=0;g<glyphs;g++) {
+			uint8_t * image = &screen._page[g / 16]._segs[(g % 16) * 8];
+			memcpy(image, font8x8_basic_tr[0x20 + (g % 0x5F)], 8);
+			ssd1306_rotate_image(image, screen._flip);
+		}
+	}
+	uint32_t fast_cycles = (esp_cpu_get_cycle_count() - begin) / ROTATE_BENCH_ROUNDS;
+
+	begin = esp_cpu_get_cycle_count();
+	for (int round=0;round<ROTATE_BENCH_ROUNDS;round++) {
+		for (int g=0;g<glyphs;g++) {
+			uint8_t * image = &screen._page[g / 16]._segs[(g % 16) * 8];
+			memcpy(image, font8x8_basic_tr[0x20 + (g % 0x5F)], 8);
+			ssd1306_rotate_image_bitwise(image, screen._flip);
+		}
+	}
+	uint32_t ref_cycles = (esp_cpu_get_cycle_count() - begin) / ROTATE_BENCH_ROUNDS;
+
+	begin = esp_cpu_get_cycle_count();
+	for (int round=0;round<ROTATE_BENCH_ROUNDS;round++) {
+		_ssd1306_bitmaps(&screen, 0, 0, bitmap, screen._width, screen._height, round & 1);
+	}
+	uint32_t bitmap_cycles = (esp_cpu_get_cycle_count() - begin) / ROTATE_BENCH_ROUNDS;
+
+	ESP_LOGI(__FUNCTION__, "%d mismatches; rotated screen of %d glyphs: %"PRIu32" cycles (bit by bit %"PRIu32"), full-screen bitmap: %"PRIu32" cycles",
+		mismatches, glyphs, fast_cycles, ref_cycles, bitmap_cycles);
+	return mismatches;
+}
+#endif
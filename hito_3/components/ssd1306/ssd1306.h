@@ -1,12 +1,20 @@
 #ifndef MAIN_SSD1306_H_
 #define MAIN_SSD1306_H_
 
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+// The linux target has no SPI/I2C drivers: only the framebuffer transport is built
+#if !CONFIG_IDF_TARGET_LINUX
 #include "driver/spi_master.h"
 #if (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 0))
 #include "driver/i2c_master.h"
 #else
 #include "driver/i2c.h"
 #endif
+#endif
 
 // Following definitions are borrowed from 
 // http://robotcantalk.blogspot.com/2015/03/interfacing-arduino-with-ssd1306-driven.html
@@ -72,9 +80,13 @@ Usage:
 #define OLED_CMD_DEACTIVE_SCROLL        0x2E
 #define OLED_CMD_ACTIVE_SCROLL          0x2F
 #define OLED_CMD_VERTICAL               0xA3
+#define OLED_CMD_CONTENT_SCROLL_RIGHT   0x2C    // One column per command, GDDRAM is shifted
+#define OLED_CMD_CONTENT_SCROLL_LEFT    0x2D
 
 #define I2C_ADDRESS 0x3C
 #define SPI_ADDRESS 0xFF
+#define OFFSCREEN_ADDRESS 0xFE // Buffer only, no transport
+#define FRAMEBUFFER_ADDRESS 0xFD // In-memory panel (ssd1306_fb.c)
 
 #define OLED_DRAW_UPPER_RIGHT 0x01
 #define OLED_DRAW_UPPER_LEFT  0x02
@@ -96,8 +108,19 @@ typedef struct {
 	bool _valid; // Not using it anymore
 	int _segLen; // Not using it anymore
 	uint8_t _segs[128];
+	int _dirtyStart; // First column changed since the last flush
+	int _dirtyEnd; // Last column changed since the last flush (< _dirtyStart when clean)
 } PAGE_t;
 
+// One-column scrolls of a buffer region not yet applied to the panel
+typedef struct {
+	int _count; // 0 = none pending
+	int _pageStart;
+	int _pageEnd;
+	int _segStart;
+	int _segEnd;
+} COLUMN_SCROLL_t;
+
 typedef struct {
 	int _address;
 	int _width;
@@ -110,12 +133,20 @@ typedef struct {
 	int _scDirection;
 	PAGE_t _page[8];
 	bool _flip;
+	uint32_t _txBytes; // Framebuffer bytes written to the panel (commands + data)
+	uint32_t _flushBytes; // Bytes written by the last ssd1306_show_buffer()
+	uint8_t _txBuf[1 + 128]; // Control byte + one page, reused by every I2C data transfer
+	COLUMN_SCROLL_t _colScroll; // Recorded by offscreen buffers, replayed by the render task
+	struct fb_panel_t * _fb; // Emulated GDDRAM and bus counters (framebuffer only)
+#if !CONFIG_IDF_TARGET_LINUX
 	i2c_port_t _i2c_num;
 	spi_device_handle_t _spi_device_handle;
+	struct spi_queue_t * _spiQueue; // Queued DMA transfers (SPI only)
 #if (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 0))
 	i2c_master_bus_handle_t _i2c_bus_handle;
 	i2c_master_dev_handle_t _i2c_dev_handle;
 #endif
+#endif
 } SSD1306_t;
 
 #ifdef __cplusplus
@@ -124,16 +155,25 @@ extern "C"
 #endif
 
 void ssd1306_init(SSD1306_t * dev, int width, int height);
+void ssd1306_init_offscreen(SSD1306_t * dev, const SSD1306_t * panel);
 int ssd1306_get_width(SSD1306_t * dev);
 int ssd1306_get_height(SSD1306_t * dev);
 int ssd1306_get_pages(SSD1306_t * dev);
 void ssd1306_show_buffer(SSD1306_t * dev);
+void ssd1306_show_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end);
+void ssd1306_show_frame(SSD1306_t * dev);
+float ssd1306_measure_fps(SSD1306_t * dev, int frames);
+void ssd1306_mark_dirty(SSD1306_t * dev, int page, int seg_start, int seg_end);
+bool ssd1306_take_dirty(SSD1306_t * dev, int page, int * seg_start, int * seg_end);
+void ssd1306_invalidate(SSD1306_t * dev);
+uint32_t ssd1306_get_flush_bytes(SSD1306_t * dev);
 void ssd1306_set_buffer(SSD1306_t * dev, const uint8_t * buffer);
 void ssd1306_get_buffer(SSD1306_t * dev, uint8_t * buffer);
 void ssd1306_set_page(SSD1306_t * dev, int page, const uint8_t * buffer);
 void ssd1306_get_page(SSD1306_t * dev, int page, uint8_t * buffer);
 void ssd1306_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
 void ssd1306_display_text(SSD1306_t * dev, int page, const char * text, int text_len, bool invert);
+void ssd1306_display_text_at(SSD1306_t * dev, int page, int seg, const char * text, int text_len, bool invert);
 void ssd1306_display_text_box1(SSD1306_t * dev, int page, int seg, const char * text, int box_width, int text_len, bool invert, int delay);
 void ssd1306_display_text_box2(SSD1306_t * dev, int page, int seg, const char * text, int box_width, int text_len, bool invert, int delay);
 void ssd1306_display_text_x3(SSD1306_t * dev, int page, const char * text, int text_len, bool invert);
@@ -144,11 +184,18 @@ void ssd1306_software_scroll(SSD1306_t * dev, int start, int end);
 void ssd1306_scroll_text(SSD1306_t * dev, const char * text, int text_len, bool invert);
 void ssd1306_scroll_clear(SSD1306_t * dev);
 void ssd1306_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll);
+void ssd1306_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end, int count);
+bool ssd1306_take_column_scroll(SSD1306_t * dev, COLUMN_SCROLL_t * scroll);
 void ssd1306_wrap_arround(SSD1306_t * dev, ssd1306_scroll_type_t scroll, int start, int end, int8_t delay);
+int ssd1306_scroll_benchmark(SSD1306_t * dev);
+int ssd1306_rotate_benchmark(SSD1306_t * dev);
 void _ssd1306_bitmaps(SSD1306_t * dev, int xpos, int ypos, const uint8_t * bitmap, int width, int height, bool invert);
 void ssd1306_bitmaps(SSD1306_t * dev, int xpos, int ypos, const uint8_t * bitmap, int width, int height, bool invert);
 void _ssd1306_pixel(SSD1306_t * dev, int xpos, int ypos, bool invert);
 void _ssd1306_line(SSD1306_t * dev, int x1, int y1, int x2, int y2,  bool invert);
+void _ssd1306_hline(SSD1306_t * dev, int x1, int x2, int y, bool invert);
+void _ssd1306_vline(SSD1306_t * dev, int x, int y1, int y2, bool invert);
+void _ssd1306_fill_rect(SSD1306_t * dev, int x1, int y1, int x2, int y2, bool invert);
 void _ssd1306_circle(SSD1306_t * dev, int x0, int y0, int r, unsigned int opt, bool invert);
 void _ssd1306_disc(SSD1306_t * dev, int x0, int y0, int r, unsigned int opt, bool invert);
 void _ssd1306_cursor(SSD1306_t * dev, int x0, int y0, int r, bool invert);
@@ -157,17 +204,34 @@ void ssd1306_flip(uint8_t *buf, size_t blen);
 uint8_t ssd1306_copy_bit(uint8_t src, int srcBits, uint8_t dst, int dstBits);
 uint8_t ssd1306_rotate_byte(uint8_t ch1);
 void ssd1306_fadeout(SSD1306_t * dev);
+uint64_t ssd1306_transpose8(uint64_t x);
 void ssd1306_rotate_image(uint8_t *image, bool flip);
 void ssd1306_display_rotate_text(SSD1306_t * dev, int seg, const char * text, int text_len, bool invert);
 void ssd1306_dump(SSD1306_t dev);
 void ssd1306_dump_page(SSD1306_t * dev, int page, int seg);
 
+void fb_master_init(SSD1306_t * dev);
+void fb_init(SSD1306_t * dev, int width, int height);
+void fb_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
+void fb_display_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end);
+void fb_contrast(SSD1306_t * dev, int contrast);
+void fb_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll);
+void fb_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end);
+void fb_get_stats(SSD1306_t * dev, uint32_t * bytes, uint32_t * transactions);
+void fb_reset_stats(SSD1306_t * dev);
+bool fb_get_pixel(SSD1306_t * dev, int x, int y);
+bool fb_save_pbm(SSD1306_t * dev, const char * path);
+
+#if !CONFIG_IDF_TARGET_LINUX
 void i2c_master_init(SSD1306_t * dev, int16_t sda, int16_t scl, int16_t reset);
 void i2c_device_add(SSD1306_t * dev, i2c_port_t i2c_num, int16_t reset, uint16_t i2c_address);
 void i2c_init(SSD1306_t * dev, int width, int height);
 void i2c_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
 void i2c_contrast(SSD1306_t * dev, int contrast);
 void i2c_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll);
+void i2c_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end);
+void i2c_display_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end);
+void i2c_bus_speed(SSD1306_t * dev, uint32_t speed_hz);
 
 void spi_clock_speed(int speed);
 void spi_master_init(SSD1306_t * dev, int16_t mosi, int16_t sclk, int16_t cs, int16_t dc, int16_t reset);
@@ -180,6 +244,12 @@ void spi_init(SSD1306_t * dev, int width, int height);
 void spi_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
 void spi_contrast(SSD1306_t * dev, int contrast);
 void spi_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll);
+void spi_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end);
+void spi_display_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end);
+void spi_queued_mode(SSD1306_t * dev, bool enable);
+void spi_queue_wait(SSD1306_t * dev);
+void spi_benchmark(SSD1306_t * dev, int frames);
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "esp_log.h"
+
+#include "ssd1306.h"
+
+#define TAG "SSD1306"
+
+// Framebuffer transport: an in-memory SSD1306 that keeps its GDDRAM in RAM.
+// Spans and windows land where the controller would put them, and the bus
+// traffic is counted with the same framing as the I2C driver, so rendering
+// code can be measured without a panel (also on the linux target).
+#define FB_INIT_BYTES 27 // Control byte + init commands, as i2c_init()
+#define FB_IMAGE_BYTES 5 // Address command stream (4) + data control byte
+#define FB_WINDOW_BYTES 13 // Window setup (9) + data control byte + restore (3)
+
+typedef struct fb_panel_t {
+	uint8_t ram[8][128]; // GDDRAM in controller page order
+	bool remap; // Segment remap A1 (set by init unless flipped)
+	uint8_t contrast;
+	uint32_t bytes;
+	uint32_t transactions;
+} fb_panel_t;
+
+static void fb_count(SSD1306_t * dev, uint32_t bytes, uint32_t transactions)
+{
+	dev->_fb->bytes += bytes;
+	dev->_fb->transactions += transactions;
+	dev->_txBytes += bytes;
+}
+
+void fb_master_init(SSD1306_t * dev)
+{
+	if (dev->_fb == NULL) dev->_fb = calloc(1, sizeof(fb_panel_t));
+	if (dev->_fb == NULL) {
+		ESP_LOGE(TAG, "No memory for the framebuffer panel");
+		return;
+	}
+	dev->_address = FRAMEBUFFER_ADDRESS;
+	dev->_flip = false;
+}
+
+void fb_init(SSD1306_t * dev, int width, int height)
+{
+	dev->_width = width;
+	dev->_height = height;
+	dev->_pages = 8;
+	if (dev->_height == 32) dev->_pages = 4;
+	if (dev->_fb == NULL) return;
+
+	memset(dev->_fb->ram, 0, sizeof(dev->_fb->ram));
+	dev->_fb->remap = !dev->_flip;
+	dev->_fb->contrast = 0xFF;
+	fb_count(dev, FB_INIT_BYTES, 1);
+}
+
+void fb_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width)
+{
+	if (dev->_fb == NULL) return;
+	if (page >= dev->_pages) return;
+	if (seg >= dev->_width) return;
+	if (width > dev->_width - seg) width = dev->_width - seg;
+
+	int _page = page;
+	if (dev->_flip) {
+		_page = (dev->_pages - page) - 1;
+	}
+	memcpy(&dev->_fb->ram[_page][seg], images, width);
+	fb_count(dev, FB_IMAGE_BYTES + width, 2);
+}
+
+// Horizontal addressing: the same pages the panel would wrap through
+void fb_display_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end)
+{
+	if (dev->_fb == NULL) return;
+	int width = seg_end - seg_start + 1;
+	int pages = page_end - page_start + 1;
+
+	for (int page=page_start;page<=page_end;page++) {
+		int _page = page;
+		if (dev->_flip) {
+			_page = (dev->_pages - page) - 1;
+		}
+		memcpy(&dev->_fb->ram[_page][seg_start], &dev->_page[page]._segs[seg_start], width);
+	}
+	fb_count(dev, FB_WINDOW_BYTES + pages * width, 3);
+}
+
+void fb_contrast(SSD1306_t * dev, int contrast)
+{
+	if (dev->_fb == NULL) return;
+	uint8_t _contrast = contrast;
+	if (contrast < 0x0) _contrast = 0;
+	if (contrast > 0xFF) _contrast = 0xFF;
+	dev->_fb->contrast = _contrast;
+	fb_count(dev, 3, 1);
+}
+
+// Hardware scroll only moves the picture, not GDDRAM: count the commands
+void fb_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll)
+{
+	if (dev->_fb == NULL) return;
+	ESP_LOGD(TAG, "Hardware scroll %d is not drawn by the framebuffer panel", scroll);
+	fb_count(dev, (scroll == SCROLL_STOP) ? 2 : 11, 1);
+}
+
+// Content scroll as the controller runs it. 2Ch/2Dh move the displayed
+// picture, so which way GDDRAM moves depends on the segment remap: the
+// command is picked as the drivers do, and the window is in GDDRAM columns
+// (only the pages are mirrored when flipped).
+void fb_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end)
+{
+	if (dev->_fb == NULL) return;
+	uint8_t command = dev->_flip ? OLED_CMD_CONTENT_SCROLL_RIGHT : OLED_CMD_CONTENT_SCROLL_LEFT;
+	// Left on the picture is towards column 0 with A1 and away from it with A0
+	bool towards_start = (command == OLED_CMD_CONTENT_SCROLL_LEFT) == dev->_fb->remap;
+	for (int page=page_start;page<=page_end;page++) {
+		int _page = page;
+		if (dev->_flip) {
+			_page = (dev->_pages - page) - 1;
+		}
+		uint8_t * ram = &dev->_fb->ram[_page][seg_start];
+		if (towards_start) {
+			memmove(ram, ram + 1, seg_end - seg_start);
+		} else {
+			memmove(ram + 1, ram, seg_end - seg_start);
+		}
+	}
+	fb_count(dev, 9, 1);
+}
+
+void fb_get_stats(SSD1306_t * dev, uint32_t * bytes, uint32_t * transactions)
+{
+	*bytes = (dev->_fb != NULL) ? dev->_fb->bytes : 0;
+	*transactions = (dev->_fb != NULL) ? dev->_fb->transactions : 0;
+}
+
+void fb_reset_stats(SSD1306_t * dev)
+{
+	if (dev->_fb == NULL) return;
+	dev->_fb->bytes = 0;
+	dev->_fb->transactions = 0;
+}
+
+// Pixel as seen on the panel, x from the left edge and y from the top
+bool fb_get_pixel(SSD1306_t * dev, int x, int y)
+{
+	if (dev->_fb == NULL) return false;
+	if (x < 0 || x >= dev->_width || y < 0 || y >= dev->_height) return false;
+	// Module mounted as with A1/C8 (no flip); a flipped device shows up rotated
+	int seg = dev->_fb->remap ? x : (dev->_width - 1 - x);
+	return (dev->_fb->ram[y >> 3][seg] >> (y & 7)) & 1;
+}
+
+// Snapshot of the panel as a binary PBM (P4), 1 = lit pixel
+bool fb_save_pbm(SSD1306_t * dev, const char * path)
+{
+	if (dev->_fb == NULL) return false;
+	FILE * fp = fopen(path, "wb");
+	if (fp == NULL) {
+		ESP_LOGE(TAG, "Could not open %s", path);
+		return false;
+	}
+	fprintf(fp, "P4\n%d %d\n", dev->_width, dev->_height);
+	for (int y=0;y<dev->_height;y++) {
+		uint8_t row[128 / 8];
+		memset(row, 0, sizeof(row));
+		for (int x=0;x<dev->_width;x++) {
+			if (fb_get_pixel(dev, x, y)) row[x >> 3] |= 0x80 >> (x & 7);
+		}
+		fwrite(row, 1, (dev->_width + 7) / 8, fp);
+	}
+	bool ok = (ferror(fp) == 0);
+	fclose(fp);
+	return ok;
+}
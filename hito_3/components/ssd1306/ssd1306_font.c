@@ -0,0 +1,217 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "esp_log.h"
+#if CONFIG_FONT_BENCHMARK
+#if CONFIG_IDF_TARGET_LINUX
+// No cycle counter on the host: the benchmark reports microseconds there
+#include "esp_timer.h"
+#define esp_cpu_get_cycle_count() ((uint32_t)esp_timer_get_time())
+#else
+#include "esp_cpu.h"
+#endif
+#endif
+
+#include "ssd1306_font.h"
+#include "ssd1306_fonts.h"
+
+#define TAG "SSD1306"
+
+const ssd1306_font_t ssd1306_font_small = { 1, 1, font_small_glyphs, font_small_data };
+const ssd1306_font_t ssd1306_font_medium = { 2, 2, font_medium_glyphs, font_medium_data };
+const ssd1306_font_t ssd1306_font_large = { 3, 3, font_large_glyphs, font_large_data };
+
+// Decoded glyphs, already inverted/flipped, ready to copy page by page
+#define FONT_CACHE_SIZE 8
+#define FONT_GLYPH_BYTES (FONT_MAX_PAGES * 24)
+#define FONT_INVERT 0x01
+#define FONT_FLIP 0x02
+
+typedef struct {
+	const ssd1306_font_t * _font; // NULL while the slot is free
+	uint8_t _index;
+	uint8_t _variant;
+	uint32_t _used; // Stamp of the last use, the oldest slot is replaced
+	uint8_t _image[FONT_GLYPH_BYTES]; // _pages rows of _width column bytes
+} font_cache_t;
+
+static font_cache_t font_cache[FONT_CACHE_SIZE];
+static uint32_t font_clock;
+
+// Glyph index of the next character; advances text past it
+static int font_next_index(const char ** text)
+{
+	const uint8_t * s = (const uint8_t *)*text;
+	uint8_t code = *s++;
+	if (code == 0xC2 && *s == 0xB0) code = *s++; // UTF-8 degree sign
+	*text = (const char *)s;
+
+	if (code >= FONT_FIRST_CODE && code < FONT_FIRST_CODE + FONT_GLYPHS - 1) return code - FONT_FIRST_CODE;
+	if (code == 0xB0) return FONT_GLYPHS - 1;
+	return '?' - FONT_FIRST_CODE;
+}
+
+// Expand the run pairs row by row into page-ordered column bytes
+static void font_decode(const ssd1306_font_t * font, int index, uint8_t * image)
+{
+	const ssd1306_glyph_t * glyph = &font->_glyphs[index];
+	const uint8_t * code = &font->_data[glyph->_offset];
+	int width = glyph->_width;
+
+	memset(image, 0, font->_pages * width);
+	int x = 0;
+	int y = 0;
+	for (int i=0;i<glyph->_size;i++) {
+		x += code[i] >> 4;
+		while (x >= width) {
+			x -= width;
+			y++;
+		}
+		for (int n = code[i] & 0x0F; n > 0; n--) {
+			image[(y >> 3) * width + x] |= 1 << (y & 7);
+			if (++x == width) {
+				x = 0;
+				y++;
+			}
+		}
+	}
+}
+
+static const uint8_t * font_glyph(const ssd1306_font_t * font, int index, uint8_t variant)
+{
+	font_cache_t * slot = &font_cache[0];
+	for (int i=0;i<FONT_CACHE_SIZE;i++) {
+		font_cache_t * entry = &font_cache[i];
+		if (entry->_font == font && entry->_index == index && entry->_variant == variant) {
+			entry->_used = ++font_clock;
+			return entry->_image;
+		}
+		if (entry->_font == NULL || entry->_used < slot->_used) slot = entry;
+		if (slot->_font == NULL) break; // Slots fill in order: the rest are free too
+	}
+
+	int bytes = font->_pages * font->_glyphs[index]._width;
+	font_decode(font, index, slot->_image);
+	if (variant & FONT_INVERT) ssd1306_invert(slot->_image, bytes);
+	if (variant & FONT_FLIP) ssd1306_flip(slot->_image, bytes);
+	slot->_font = font;
+	slot->_index = index;
+	slot->_variant = variant;
+	slot->_used = ++font_clock;
+	return slot->_image;
+}
+
+// Columns the text takes, spacing included
+int ssd1306_font_text_width(const ssd1306_font_t * font, const char * text)
+{
+	int width = 0;
+	while (*text) {
+		int index = font_next_index(&text);
+		if (width > 0) width += font->_spacing;
+		width += font->_glyphs[index]._width;
+	}
+	return width;
+}
+
+// Draw text with its top at page and its left edge at seg.
+// Every page of the line goes out as one transfer.
+// Returns the column after the last glyph drawn.
+int ssd1306_display_font_text(SSD1306_t * dev, const ssd1306_font_t * font, int page, int seg, const char * text, bool invert)
+{
+	if (page < 0 || page + font->_pages > dev->_pages) return seg;
+	if (seg < 0 || seg >= dev->_width) return seg;
+
+	uint8_t variant = (invert ? FONT_INVERT : 0) | (dev->_flip ? FONT_FLIP : 0);
+	uint8_t blank = invert ? 0xFF : 0x00;
+	uint8_t image[FONT_MAX_PAGES][128];
+	int width = 0;
+	while (*text) {
+		int index = font_next_index(&text);
+		int _width = font->_glyphs[index]._width;
+		int gap = (width > 0) ? font->_spacing : 0;
+		if (width + gap + _width > dev->_width - seg) break;
+
+		const uint8_t * glyph = font_glyph(font, index, variant);
+		for (int p=0;p<font->_pages;p++) {
+			memset(&image[p][width], blank, gap);
+			memcpy(&image[p][width + gap], &glyph[p * _width], _width);
+		}
+		width += gap + _width;
+	}
+
+	if (width == 0) return seg;
+	for (int p=0;p<font->_pages;p++) {
+		ssd1306_display_image(dev, page + p, seg, image[p], width);
+	}
+	return seg + width;
+}
+
+#if CONFIG_FONT_BENCHMARK
+#define FONT_BENCH_ROUNDS 16
+
+// Cost of drawing a temperature in the 24 px font, with an empty and with a
+// warm glyph cache, against the same digits through ssd1306_display_text_x3.
+// Drawn on a framebuffer panel: cycles plus the bytes and transactions the
+// I2C bus would carry, and how many digits fit in a line.
+// Returns the pixels where the warm-cache text differs from the cold one
+// (-1 without memory for the framebuffer).
+int ssd1306_font_benchmark(SSD1306_t * dev)
+{
+	static SSD1306_t screen;
+	static uint8_t cold[64][128 / 8];
+	const char * text = "23.45 " FONT_DEGREE "C";
+	uint32_t bytes, transactions, x3_bytes, x3_transactions;
+
+	fb_master_init(&screen);
+	fb_init(&screen, dev->_width, dev->_height);
+	if (screen._fb == NULL) return -1;
+
+	memset(font_cache, 0, sizeof(font_cache));
+	uint32_t begin = esp_cpu_get_cycle_count();
+	int end = ssd1306_display_font_text(&screen, &ssd1306_font_large, 0, 0, text, false);
+	uint32_t cold_cycles = esp_cpu_get_cycle_count() - begin;
+
+	memset(cold, 0, sizeof(cold));
+	for (int y=0;y<screen._height;y++) {
+		for (int x=0;x<screen._width;x++) {
+			if (fb_get_pixel(&screen, x, y)) cold[y][x >> 3] |= 0x80 >> (x & 7);
+		}
+	}
+
+	fb_reset_stats(&screen);
+	begin = esp_cpu_get_cycle_count();
+	for (int round=0;round<FONT_BENCH_ROUNDS;round++) {
+		ssd1306_display_font_text(&screen, &ssd1306_font_large, 0, 0, text, false);
+	}
+	uint32_t warm_cycles = (esp_cpu_get_cycle_count() - begin) / FONT_BENCH_ROUNDS;
+	fb_get_stats(&screen, &bytes, &transactions);
+
+	int mismatches = 0;
+	for (int y=0;y<screen._height;y++) {
+		for (int x=0;x<screen._width;x++) {
+			bool lit = (cold[y][x >> 3] >> (7 - (x & 7))) & 1;
+			if (fb_get_pixel(&screen, x, y) != lit) mismatches++;
+		}
+	}
+
+	fb_reset_stats(&screen);
+	begin = esp_cpu_get_cycle_count();
+	for (int round=0;round<FONT_BENCH_ROUNDS;round++) {
+		ssd1306_display_text_x3(&screen, 3, "23.45", 5, false);
+	}
+	uint32_t x3_cycles = (esp_cpu_get_cycle_count() - begin) / FONT_BENCH_ROUNDS;
+	fb_get_stats(&screen, &x3_bytes, &x3_transactions);
+
+	const ssd1306_glyph_t * last = &ssd1306_font_large._glyphs[FONT_GLYPHS - 1];
+	ESP_LOGI(TAG, "24 px \"%s\": %d columns, %"PRIu32" cycles (cold cache %"PRIu32"), %"PRIu32" bytes in %"PRIu32" transactions, %d pixels differ",
+		text, end, warm_cycles, cold_cycles, bytes / FONT_BENCH_ROUNDS, transactions / FONT_BENCH_ROUNDS, mismatches);
+	ESP_LOGI(TAG, "x3 \"23.45\": 120 columns, %"PRIu32" cycles, %"PRIu32" bytes in %"PRIu32" transactions",
+		x3_cycles, x3_bytes / FONT_BENCH_ROUNDS, x3_transactions / FONT_BENCH_ROUNDS);
+	ESP_LOGI(TAG, "Digits per line: %d at 24 px, %d at 16 px (x3: 5); 24 px font data %d bytes",
+		(screen._width + 3) / (ssd1306_font_large._glyphs['0' - FONT_FIRST_CODE]._width + 3),
+		(screen._width + 2) / (ssd1306_font_medium._glyphs['0' - FONT_FIRST_CODE]._width + 2),
+		last->_offset + last->_size);
+	return mismatches;
+}
+#endif
@@ -0,0 +1,50 @@
+#ifndef MAIN_SSD1306_FONT_H_
+#define MAIN_SSD1306_FONT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ssd1306.h"
+
+// Proportional fonts of one to three pages, run-length coded in flash.
+// They cover U+0020-U+007E and the degree sign, written as UTF-8
+// (FONT_DEGREE) or as the Latin-1 byte 0xB0. Glyphs are decoded on first
+// use into a small LRU cache, so redrawing the same digits costs one copy
+// per page. Text is page aligned and clipped at the right edge.
+
+#define FONT_FIRST_CODE 0x20
+#define FONT_GLYPHS 96 // U+0020-U+007E and the degree sign
+#define FONT_MAX_PAGES 3
+#define FONT_DEGREE "\xC2\xB0"
+
+typedef struct {
+	uint16_t _offset; // First coded byte in the font data
+	uint8_t _width; // Columns
+	uint8_t _size; // Coded bytes
+} ssd1306_glyph_t;
+
+typedef struct {
+	uint8_t _pages; // Height in pages of 8 pixels
+	uint8_t _spacing; // Blank columns between glyphs
+	const ssd1306_glyph_t * _glyphs;
+	const uint8_t * _data;
+} ssd1306_font_t;
+
+extern const ssd1306_font_t ssd1306_font_small; // 8 px
+extern const ssd1306_font_t ssd1306_font_medium; // 16 px
+extern const ssd1306_font_t ssd1306_font_large; // 24 px
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+int ssd1306_font_text_width(const ssd1306_font_t * font, const char * text);
+int ssd1306_display_font_text(SSD1306_t * dev, const ssd1306_font_t * font, int page, int seg, const char * text, bool invert);
+int ssd1306_font_benchmark(SSD1306_t * dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_FONT_H_ */
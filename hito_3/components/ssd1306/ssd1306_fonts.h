@@ -0,0 +1,554 @@
+/*
+ * ssd1306_fonts.h
+ *
+ * Proportional 8, 16 and 24 pixel fonts for ssd1306_font.c, drawn from the
+ * glyphs of font8x8_basic_tr (U+0020-U+007E) plus a degree sign.
+ *
+ * Generated with the following procedure:
+ *  - 16 and 24 px: scale the 8x8 glyph with Scale2x / Scale3x (EPX edge
+ *    smoothing), pixels outside the glyph count as blank.
+ *  - Trim the blank columns on both sides. The space keeps 3 columns per
+ *    8 px of height, and the digits are all as wide as the widest one and
+ *    centred (tabular digits, so that a changing value does not move).
+ *  - Scan the glyph row by row, top to bottom, and code it as one byte per
+ *    run pair: high nibble = blank pixels, low nibble = lit pixels that
+ *    follow (0-15 each). Trailing blank pixels are not stored.
+ *
+ * Glyph entries are { offset in the data, width in columns, coded bytes }.
+ */
+
+#ifndef MAIN_SSD1306_FONTS_H_
+#define MAIN_SSD1306_FONTS_H_
+
+#include "ssd1306_font.h"
+
+// 8 px high, 1 page: 579 bytes of glyph columns packed into 684
+static const uint8_t font_small_data[684] = {
+	// U+0020 ( )
+	0x12, 0x18, 0x12, 0x22, 0x62, // U+0021 (!)
+	0x02, 0x14, 0x12, // U+0022 (")
+	0x12, 0x12, 0x22, 0x12, 0x17, 0x12, 0x12, 0x17, 0x12, 0x12, 0x22, 0x12, // U+0023 (#)
+	0x22, 0x37, 0x54, 0x57, 0x32, // U+0024 ($)
+	0x72, 0x34, 0x22, 0x42, 0x42, 0x42, 0x24, 0x32, // U+0025 (%)
+	0x23, 0x32, 0x12, 0x33, 0x33, 0x14, 0x13, 0x12, 0x22, 0x23, 0x12, // U+0026 (&)
+	0x12, 0x14, // U+0027 (')
+	0x22, 0x12, 0x12, 0x22, 0x22, 0x32, 0x32, // U+0028 (()
+	0x02, 0x32, 0x32, 0x22, 0x22, 0x12, 0x12, // U+0029 ())
+	0x92, 0x22, 0x34, 0x28, 0x24, 0x32, 0x22, // U+002A (*)
+	0x82, 0x42, 0x26, 0x22, 0x42, // U+002B (+)
+	0xF0, 0x12, 0x14, // U+002C (,)
+	0xF0, 0x36, // U+002D (-)
+	0xA4, // U+002E (.)
+	0x52, 0x42, 0x42, 0x42, 0x42, 0x42, 0x51, // U+002F (/)
+	0x15, 0x12, 0x34, 0x25, 0x18, 0x15, 0x22, 0x15, // U+0030 (0)
+	0x22, 0x43, 0x52, 0x52, 0x52, 0x52, 0x36, // U+0031 (1)
+	0x14, 0x22, 0x22, 0x52, 0x33, 0x32, 0x42, 0x22, 0x16, // U+0032 (2)
+	0x14, 0x22, 0x22, 0x52, 0x33, 0x62, 0x12, 0x22, 0x24, // U+0033 (3)
+	0x33, 0x34, 0x22, 0x12, 0x12, 0x22, 0x17, 0x42, 0x44, // U+0034 (4)
+	0x06, 0x12, 0x55, 0x62, 0x52, 0x12, 0x22, 0x24, // U+0035 (5)
+	0x23, 0x32, 0x42, 0x55, 0x22, 0x22, 0x12, 0x22, 0x24, // U+0036 (6)
+	0x06, 0x12, 0x22, 0x52, 0x42, 0x42, 0x52, 0x52, // U+0037 (7)
+	0x14, 0x22, 0x22, 0x12, 0x22, 0x24, 0x22, 0x22, 0x12, 0x22, 0x24, // U+0038 (8)
+	0x14, 0x22, 0x22, 0x12, 0x22, 0x25, 0x52, 0x42, 0x33, // U+0039 (9)
+	0x24, 0x44, // U+003A (:)
+	0x42, 0x12, 0x72, 0x14, // U+003B (;)
+	0x32, 0x22, 0x22, 0x22, 0x42, 0x42, 0x42, // U+003C (<)
+	0xC6, 0xC6, // U+003D (=)
+	0x02, 0x42, 0x42, 0x42, 0x22, 0x22, 0x22, // U+003E (>)
+	0x14, 0x12, 0x22, 0x42, 0x32, 0x32, 0xA2, // U+003F (?)
+	0x15, 0x12, 0x34, 0x16, 0x16, 0x16, 0x64, // U+0040 (@)
+	0x22, 0x34, 0x12, 0x24, 0x2A, 0x24, 0x22, // U+0041 (A)
+	0x06, 0x22, 0x22, 0x12, 0x22, 0x15, 0x22, 0x22, 0x12, 0x28, // U+0042 (B)
+	0x24, 0x22, 0x24, 0x52, 0x52, 0x62, 0x22, 0x24, // U+0043 (C)
+	0x05, 0x32, 0x12, 0x22, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x12, 0x15, // U+0044 (D)
+	0x07, 0x12, 0x31, 0x12, 0x11, 0x34, 0x32, 0x11, 0x32, 0x38, // U+0045 (E)
+	0x07, 0x12, 0x31, 0x12, 0x11, 0x34, 0x32, 0x11, 0x32, 0x44, // U+0046 (F)
+	0x24, 0x22, 0x24, 0x52, 0x52, 0x23, 0x12, 0x22, 0x25, // U+0047 (G)
+	0x02, 0x24, 0x24, 0x2A, 0x24, 0x24, 0x22, // U+0048 (H)
+	0x04, 0x12, 0x22, 0x22, 0x22, 0x22, 0x14, // U+0049 (I)
+	0x34, 0x42, 0x52, 0x52, 0x12, 0x22, 0x12, 0x22, 0x24, // U+004A (J)
+	0x03, 0x22, 0x12, 0x22, 0x12, 0x12, 0x24, 0x32, 0x12, 0x22, 0x25, 0x22, // U+004B (K)
+	0x04, 0x42, 0x52, 0x52, 0x52, 0x31, 0x12, 0x29, // U+004C (L)
+	0x02, 0x35, 0x1F, 0x04, 0x11, 0x14, 0x34, 0x32, // U+004D (M)
+	0x02, 0x35, 0x26, 0x14, 0x16, 0x25, 0x34, 0x32, // U+004E (N)
+	0x23, 0x32, 0x12, 0x12, 0x34, 0x34, 0x32, 0x12, 0x12, 0x33, // U+004F (O)
+	0x06, 0x22, 0x22, 0x12, 0x22, 0x15, 0x22, 0x52, 0x44, // U+0050 (P)
+	0x14, 0x12, 0x24, 0x24, 0x24, 0x13, 0x14, 0x43, // U+0051 (Q)
+	0x06, 0x22, 0x22, 0x12, 0x22, 0x15, 0x22, 0x12, 0x22, 0x25, 0x22, // U+0052 (R)
+	0x14, 0x12, 0x25, 0x43, 0x55, 0x22, 0x14, // U+0053 (S)
+	0x07, 0x12, 0x11, 0x22, 0x42, 0x42, 0x42, 0x34, // U+0054 (T)
+	0x02, 0x24, 0x24, 0x24, 0x24, 0x24, 0x28, // U+0055 (U)
+	0x02, 0x24, 0x24, 0x24, 0x24, 0x22, 0x14, 0x32, // U+0056 (V)
+	0x02, 0x34, 0x34, 0x34, 0x11, 0x1C, 0x15, 0x32, // U+0057 (W)
+	0x02, 0x34, 0x32, 0x12, 0x12, 0x33, 0x43, 0x32, 0x12, 0x12, 0x32, // U+0058 (X)
+	0x02, 0x24, 0x24, 0x22, 0x14, 0x32, 0x42, 0x34, // U+0059 (Y)
+	0x09, 0x33, 0x32, 0x42, 0x42, 0x21, 0x12, 0x29, // U+005A (Z)
+	0x06, 0x22, 0x22, 0x22, 0x22, 0x24, // U+005B ([)
+	0x02, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, // U+005C (\)
+	0x04, 0x22, 0x22, 0x22, 0x22, 0x26, // U+005D (])
+	0x31, 0x53, 0x32, 0x12, 0x12, 0x32, // U+005E (^)
+	0xF0, 0xF0, 0xF0, 0xB8, // U+005F (_)
+	0x02, 0x12, 0x22, // U+0060 (`)
+	0xF4, 0x62, 0x25, 0x12, 0x22, 0x23, 0x12, // U+0061 (a)
+	0x03, 0x52, 0x52, 0x55, 0x22, 0x22, 0x12, 0x24, 0x13, // U+0062 (b)
+	0xD4, 0x12, 0x24, 0x42, 0x22, 0x14, // U+0063 (c)
+	0x33, 0x52, 0x52, 0x25, 0x12, 0x22, 0x12, 0x22, 0x23, 0x12, // U+0064 (d)
+	0xD4, 0x12, 0x2A, 0x54, // U+0065 (e)
+	0x23, 0x22, 0x12, 0x12, 0x34, 0x32, 0x42, 0x34, // U+0066 (f)
+	0xF3, 0x14, 0x22, 0x12, 0x22, 0x25, 0x52, 0x15, // U+0067 (g)
+	0x03, 0x52, 0x52, 0x12, 0x23, 0x12, 0x12, 0x22, 0x12, 0x25, 0x22, // U+0068 (h)
+	0x12, 0x53, 0x22, 0x22, 0x22, 0x14, // U+0069 (i)
+	0x42, 0xA2, 0x42, 0x44, 0x24, 0x22, 0x14, // U+006A (j)
+	0x03, 0x52, 0x52, 0x22, 0x12, 0x12, 0x24, 0x32, 0x12, 0x13, 0x22, // U+006B (k)
+	0x03, 0x22, 0x22, 0x22, 0x22, 0x22, 0x14, // U+006C (l)
+	0xE2, 0x22, 0x1F, 0x01, 0x11, 0x14, 0x32, // U+006D (m)
+	0xC5, 0x12, 0x24, 0x24, 0x24, 0x22, // U+006E (n)
+	0xD4, 0x12, 0x24, 0x24, 0x22, 0x14, // U+006F (o)
+	0xE2, 0x13, 0x22, 0x22, 0x12, 0x22, 0x15, 0x22, 0x44, // U+0070 (p)
+	0xF3, 0x14, 0x22, 0x12, 0x22, 0x25, 0x52, 0x44, // U+0071 (q)
+	0xE2, 0x13, 0x23, 0x12, 0x12, 0x22, 0x12, 0x44, // U+0072 (r)
+	0xD7, 0x54, 0x57, // U+0073 (s)
+	0x21, 0x32, 0x25, 0x12, 0x32, 0x32, 0x11, 0x22, // U+0074 (t)
+	0xE2, 0x22, 0x12, 0x22, 0x12, 0x22, 0x12, 0x22, 0x23, 0x12, // U+0075 (u)
+	0xC2, 0x24, 0x24, 0x22, 0x14, 0x32, // U+0076 (v)
+	0xE2, 0x34, 0x11, 0x1F, 0x01, 0x12, 0x12, // U+0077 (w)
+	0xE2, 0x32, 0x12, 0x12, 0x33, 0x32, 0x12, 0x12, 0x32, // U+0078 (x)
+	0xC2, 0x24, 0x24, 0x22, 0x15, 0x47, // U+0079 (y)
+	0xC7, 0x22, 0x32, 0x32, 0x27, // U+007A (z)
+	0x33, 0x22, 0x42, 0x23, 0x52, 0x42, 0x53, // U+007B ({)
+	0x06, 0x26, // U+007C (|)
+	0x03, 0x52, 0x42, 0x53, 0x22, 0x42, 0x23, // U+007D (})
+	0x13, 0x14, 0x13, // U+007E (~)
+	0x12, 0x11, 0x22, 0x21, 0x12, // U+00B0 (degree)
+};
+
+static const ssd1306_glyph_t font_small_glyphs[FONT_GLYPHS] = {
+	{ 0, 3, 0 }, { 0, 4, 5 }, { 5, 5, 3 }, { 8, 7, 12 }, { 20, 6, 5 }, { 25, 7, 8 },
+	{ 33, 7, 11 }, { 44, 3, 2 }, { 46, 4, 7 }, { 53, 4, 7 }, { 60, 8, 7 }, { 67, 6, 5 },
+	{ 72, 3, 3 }, { 75, 6, 2 }, { 77, 2, 1 }, { 78, 7, 7 }, { 85, 7, 8 }, { 93, 7, 7 },
+	{ 100, 7, 9 }, { 109, 7, 9 }, { 118, 7, 9 }, { 127, 7, 8 }, { 135, 7, 9 }, { 144, 7, 8 },
+	{ 152, 7, 11 }, { 163, 7, 9 }, { 172, 2, 2 }, { 174, 3, 4 }, { 178, 5, 7 },
+	{ 185, 6, 2 }, { 187, 5, 7 }, { 194, 6, 7 }, { 201, 7, 7 }, { 208, 6, 7 },
+	{ 215, 7, 10 }, { 225, 7, 8 }, { 233, 7, 12 }, { 245, 7, 10 }, { 255, 7, 10 },
+	{ 265, 7, 9 }, { 274, 6, 7 }, { 281, 4, 7 }, { 288, 7, 9 }, { 297, 7, 12 },
+	{ 309, 7, 8 }, { 317, 7, 8 }, { 325, 7, 8 }, { 333, 7, 10 }, { 343, 7, 9 },
+	{ 352, 6, 8 }, { 360, 7, 11 }, { 371, 6, 7 }, { 378, 6, 8 }, { 386, 6, 7 },
+	{ 393, 6, 8 }, { 401, 7, 8 }, { 409, 7, 11 }, { 420, 6, 8 }, { 428, 7, 8 },
+	{ 436, 4, 6 }, { 442, 7, 7 }, { 449, 4, 6 }, { 455, 7, 6 }, { 461, 8, 4 }, { 465, 3, 3 },
+	{ 468, 7, 7 }, { 475, 7, 9 }, { 484, 6, 6 }, { 490, 7, 10 }, { 500, 6, 4 },
+	{ 504, 6, 8 }, { 512, 7, 8 }, { 520, 7, 11 }, { 531, 4, 6 }, { 537, 6, 7 },
+	{ 544, 7, 11 }, { 555, 4, 7 }, { 562, 7, 7 }, { 569, 6, 6 }, { 575, 6, 6 },
+	{ 581, 7, 9 }, { 590, 7, 8 }, { 598, 7, 8 }, { 606, 6, 3 }, { 609, 5, 8 },
+	{ 617, 7, 10 }, { 627, 6, 6 }, { 633, 7, 7 }, { 640, 7, 9 }, { 649, 6, 6 },
+	{ 655, 6, 5 }, { 660, 6, 7 }, { 667, 2, 2 }, { 669, 6, 7 }, { 676, 7, 3 }, { 679, 4, 5 },
+};
+
+// 16 px high, 2 pages: 2316 bytes of glyph columns packed into 1539
+static const uint8_t font_medium_data[1539] = {
+	// U+0020 ( )
+	0x32, 0x46, 0x26, 0x1F, 0x01, 0x16, 0x26, 0x34, 0x44, 0x52, 0xF0, 0x64, 0x44, // U+0021 (!)
+	0x12, 0x42, 0x14, 0x28, 0x24, 0x12, 0x42, // U+0022 (")
+	0x32, 0x42, 0x54, 0x24, 0x44, 0x24, 0x35, 0x25, 0x1F, 0x0D, 0x24, 0x24, 0x44, 0x24, 0x2F, 0x0D,
+	0x15, 0x25, 0x34, 0x24, 0x44, 0x24, 0x52, 0x42, // U+0023 (#)
+	0x52, 0x86, 0x69, 0x1F, 0x84, 0x98, 0x68, 0x94, 0x8F, 0x19, 0x66, 0x82, // U+0024 ($)
+	0xF0, 0xE2, 0x87, 0x59, 0x54, 0x22, 0x44, 0xA4, 0x84, 0xA4, 0x84, 0xA4, 0x42, 0x24, 0x59, 0x57,
+	0x82, // U+0025 (%)
+	0x54, 0x88, 0x54, 0x24, 0x44, 0x24, 0x66, 0x85, 0x85, 0x33, 0x17, 0x24, 0x13, 0x27, 0x14, 0x35,
+	0x24, 0x44, 0x34, 0x44, 0x27, 0x24, 0x35, 0x33, // U+0026 (&)
+	0x32, 0x34, 0x24, 0x14, 0x15, 0x13, // U+0027 (')
+	0x53, 0x35, 0x34, 0x24, 0x44, 0x34, 0x44, 0x44, 0x44, 0x54, 0x44, 0x64, 0x45, 0x53, // U+0028 (()
+	0x03, 0x55, 0x44, 0x64, 0x44, 0x54, 0x44, 0x44, 0x44, 0x34, 0x44, 0x24, 0x35, 0x33, // U+0029 ())
+	0xF0, 0xF0, 0x43, 0x63, 0x45, 0x25, 0x68, 0x88, 0x4F, 0x0F, 0x02, 0x48, 0x88, 0x65, 0x25, 0x43,
+	0x63, // U+002A (*)
+	0xF0, 0xE2, 0x94, 0x84, 0x76, 0x3F, 0x09, 0x36, 0x74, 0x84, 0x92, // U+002B (+)
+	0xF0, 0xF0, 0xF0, 0xF0, 0x32, 0x34, 0x24, 0x14, 0x15, 0x13, // U+002C (,)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xCF, 0x09, // U+002D (-)
+	0xF0, 0xF0, 0xB2, 0x18, 0x12, // U+002E (.)
+	0xB3, 0x95, 0x94, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0xA4, 0x84, 0xA4, 0x93, 0xB3, 0xB2, // U+002F (/)
+	0x38, 0x4C, 0x24, 0x53, 0x14, 0x68, 0x59, 0x3B, 0x3B, 0x2F, 0x01, 0x2B, 0x3A, 0x44, 0x15, 0x34,
+	0x2C, 0x48, // U+0030 (0)
+	0x62, 0xA5, 0x86, 0x86, 0x95, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x96, 0x5C, 0x2C, // U+0031 (1)
+	0x46, 0x6A, 0x35, 0x24, 0x33, 0x54, 0xA4, 0x94, 0x86, 0x66, 0x84, 0x84, 0xA3, 0x52, 0x34, 0x35,
+	0x2C, 0x3A, // U+0032 (2)
+	0x46, 0x6A, 0x35, 0x24, 0x33, 0x54, 0xA4, 0x94, 0x76, 0x86, 0xB4, 0xB4, 0x23, 0x54, 0x25, 0x24,
+	0x4A, 0x66, // U+0033 (3)
+	0x74, 0x87, 0x77, 0x59, 0x53, 0x24, 0x34, 0x34, 0x33, 0x44, 0x24, 0x36, 0x1E, 0x1D, 0x84, 0xA4,
+	0x88, 0x68, // U+0034 (4)
+	0x2B, 0x2C, 0x24, 0xA4, 0xA9, 0x6A, 0xA4, 0xB4, 0xA4, 0xA4, 0x23, 0x54, 0x25, 0x24, 0x4A, 0x66, // U+0035 (5)
+	0x65, 0x77, 0x74, 0x84, 0xA3, 0xA4, 0xA9, 0x5B, 0x35, 0x24, 0x34, 0x44, 0x24, 0x44, 0x34, 0x24,
+	0x4A, 0x66, // U+0036 (6)
+	0x2A, 0x3C, 0x25, 0x25, 0x32, 0x54, 0xA4, 0x94, 0xA4, 0x84, 0xA4, 0x94, 0xA4, 0xA4, 0xA4, 0xB2, // U+0037 (7)
+	0x46, 0x6A, 0x44, 0x24, 0x34, 0x44, 0x24, 0x44, 0x34, 0x24, 0x58, 0x68, 0x54, 0x24, 0x34, 0x44,
+	0x24, 0x44, 0x34, 0x24, 0x4A, 0x66, // U+0038 (8)
+	0x46, 0x6A, 0x44, 0x24, 0x34, 0x44, 0x24, 0x44, 0x34, 0x25, 0x3B, 0x59, 0xA4, 0xA3, 0xA4, 0x84,
+	0x77, 0x75, // U+0039 (9)
+	0x92, 0x18, 0x12, 0xF0, 0x32, 0x18, 0x12, // U+003A (:)
+	0xF2, 0x34, 0x24, 0x32, 0xF0, 0xD2, 0x34, 0x24, 0x14, 0x15, 0x13, // U+003B (;)
+	0x73, 0x55, 0x54, 0x44, 0x64, 0x44, 0x54, 0x64, 0x74, 0x84, 0x64, 0x84, 0x65, 0x73, // U+003C (<)
+	0xF0, 0xF0, 0xF0, 0x3F, 0x09, 0xF0, 0xF0, 0xF0, 0x3F, 0x09, // U+003D (=)
+	0x03, 0x75, 0x64, 0x84, 0x64, 0x84, 0x74, 0x64, 0x54, 0x44, 0x64, 0x44, 0x55, 0x53, // U+003E (>)
+	0x36, 0x4A, 0x15, 0x24, 0x13, 0x54, 0x84, 0x74, 0x84, 0x64, 0x75, 0x73, 0xF0, 0xF0, 0x34, 0x84, // U+003F (?)
+	0x38, 0x4C, 0x24, 0x53, 0x14, 0x68, 0x3B, 0x2C, 0x2C, 0x2C, 0x2C, 0x36, 0x14, 0xB4, 0xA9, 0x77, // U+0040 (@)
+	0x52, 0x86, 0x66, 0x4A, 0x24, 0x24, 0x14, 0x48, 0x49, 0x2F, 0x0F, 0x04, 0x29, 0x48, 0x44, 0x12,
+	0x62, // U+0041 (A)
+	0x0B, 0x3D, 0x26, 0x24, 0x34, 0x44, 0x24, 0x44, 0x25, 0x24, 0x3A, 0x4A, 0x45, 0x24, 0x34, 0x44,
+	0x24, 0x44, 0x16, 0x24, 0x1D, 0x1B, // U+0042 (B)
+	0x56, 0x6A, 0x44, 0x25, 0x14, 0x63, 0x14, 0x94, 0xA4, 0xA4, 0xA4, 0xB4, 0xA4, 0x63, 0x34, 0x25,
+	0x3A, 0x66, // U+0043 (C)
+	0x09, 0x5B, 0x45, 0x23, 0x54, 0x34, 0x34, 0x34, 0x34, 0x44, 0x24, 0x44, 0x24, 0x44, 0x24, 0x44,
+	0x24, 0x34, 0x34, 0x34, 0x25, 0x23, 0x3B, 0x39, // U+0044 (D)
+	0x0D, 0x1E, 0x16, 0x43, 0x24, 0x62, 0x24, 0x22, 0x64, 0x22, 0x68, 0x68, 0x64, 0x22, 0x64, 0x22,
+	0x64, 0x62, 0x16, 0x4F, 0x0F, // U+0045 (E)
+	0x0D, 0x1E, 0x16, 0x43, 0x24, 0x62, 0x24, 0x22, 0x64, 0x22, 0x68, 0x68, 0x64, 0x22, 0x64, 0x22,
+	0x64, 0x96, 0x78, 0x68, // U+0046 (F)
+	0x56, 0x6A, 0x44, 0x25, 0x14, 0x63, 0x14, 0x94, 0xA4, 0xA4, 0xA4, 0x45, 0x24, 0x36, 0x14, 0x54,
+	0x34, 0x34, 0x3B, 0x58, // U+0047 (G)
+	0x12, 0x62, 0x14, 0x48, 0x48, 0x48, 0x49, 0x2F, 0x0F, 0x04, 0x29, 0x48, 0x48, 0x48, 0x44, 0x12,
+	0x62, // U+0048 (H)
+	0x0F, 0x01, 0x16, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x36, 0x1F, 0x01, // U+0049 (I)
+	0x68, 0x68, 0x76, 0x94, 0xA4, 0xA4, 0xA4, 0xA4, 0x32, 0x54, 0x24, 0x44, 0x24, 0x44, 0x34, 0x24,
+	0x4A, 0x66, // U+004A (J)
+	0x05, 0x62, 0x16, 0x44, 0x15, 0x44, 0x24, 0x34, 0x34, 0x34, 0x34, 0x23, 0x58, 0x68, 0x64, 0x23,
+	0x54, 0x34, 0x34, 0x34, 0x25, 0x4A, 0x49, 0x62, // U+004B (K)
+	0x08, 0x68, 0x76, 0x94, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x62, 0x24, 0x53, 0x24, 0x53, 0x16, 0x2F,
+	0x0F, 0x02, // U+004C (L)
+	0x12, 0x82, 0x15, 0x4A, 0x4B, 0x2F, 0x0F, 0x0F, 0x0F, 0x06, 0x22, 0x28, 0x22, 0x28, 0x68, 0x68,
+	0x64, 0x12, 0x82, // U+004D (M)
+	0x12, 0x82, 0x15, 0x59, 0x5B, 0x3B, 0x3C, 0x28, 0x2C, 0x3B, 0x3B, 0x59, 0x59, 0x68, 0x64, 0x12,
+	0x82, // U+004E (N)
+	0x54, 0x88, 0x63, 0x23, 0x44, 0x44, 0x24, 0x44, 0x14, 0x68, 0x68, 0x68, 0x64, 0x14, 0x44, 0x24,
+	0x44, 0x43, 0x23, 0x68, 0x84, // U+004F (O)
+	0x0B, 0x3D, 0x26, 0x24, 0x34, 0x44, 0x24, 0x44, 0x25, 0x24, 0x3B, 0x39, 0x55, 0x94, 0xA4, 0x96,
+	0x78, 0x68, // U+0050 (P)
+	0x36, 0x4A, 0x24, 0x24, 0x14, 0x48, 0x48, 0x48, 0x48, 0x39, 0x35, 0x13, 0x25, 0x29, 0x57, 0x77,
+	0x75, // U+0051 (Q)
+	0x0B, 0x3D, 0x26, 0x24, 0x34, 0x44, 0x24, 0x44, 0x25, 0x24, 0x3B, 0x3A, 0x44, 0x24, 0x44, 0x34,
+	0x34, 0x34, 0x25, 0x4A, 0x49, 0x62, // U+0052 (R)
+	0x36, 0x4A, 0x23, 0x39, 0x58, 0x86, 0x66, 0x86, 0x86, 0x88, 0x59, 0x33, 0x2A, 0x46, // U+0053 (S)
+	0x1A, 0x1E, 0x24, 0x24, 0x24, 0x22, 0x44, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x76, 0x58, 0x48, // U+0054 (T)
+	0x12, 0x62, 0x14, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x2F, 0x02, 0x1A, // U+0055 (U)
+	0x12, 0x62, 0x14, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x14, 0x24, 0x2A, 0x46, 0x66,
+	0x82, // U+0056 (V)
+	0x12, 0x82, 0x14, 0x68, 0x68, 0x68, 0x68, 0x68, 0x22, 0x28, 0x22, 0x2F, 0x0F, 0x08, 0x2B, 0x4A,
+	0x45, 0x12, 0x82, // U+0057 (W)
+	0x12, 0x82, 0x14, 0x68, 0x64, 0x14, 0x44, 0x24, 0x44, 0x43, 0x23, 0x68, 0x76, 0x86, 0x78, 0x63,
+	0x23, 0x44, 0x44, 0x15, 0x48, 0x83, // U+0058 (X)
+	0x12, 0x62, 0x14, 0x48, 0x48, 0x48, 0x44, 0x14, 0x24, 0x2A, 0x46, 0x66, 0x74, 0x84, 0x76, 0x58,
+	0x48, // U+0059 (Y)
+	0x1C, 0x1F, 0x04, 0x57, 0x73, 0x13, 0x64, 0x12, 0x54, 0xA4, 0x84, 0xA4, 0x32, 0x34, 0x43, 0x33,
+	0x53, 0x15, 0x3F, 0x0F, 0x02, // U+005A (Z)
+	0x1F, 0x05, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x38, 0x17, // U+005B ([)
+	0x03, 0xB5, 0xA4, 0xC4, 0xA4, 0xC4, 0xA4, 0xC4, 0xA4, 0xC4, 0xA4, 0xC3, 0xB3, 0xC2, // U+005C (\)
+	0x07, 0x18, 0x35, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x05, // U+005D (])
+	0x62, 0xB4, 0xA4, 0x88, 0x63, 0x23, 0x44, 0x44, 0x15, 0x48, 0x83, // U+005E (^)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0x0F,
+	0x02, // U+005F (_)
+	0x12, 0x34, 0x24, 0x34, 0x25, 0x33, // U+0060 (`)
+	0xF0, 0xF0, 0xF0, 0xD7, 0x79, 0xB3, 0xB4, 0x59, 0x3B, 0x24, 0x44, 0x24, 0x54, 0x27, 0x24, 0x35,
+	0x33, // U+0061 (a)
+	0x05, 0x96, 0x95, 0xA4, 0xA4, 0xA5, 0x99, 0x5B, 0x35, 0x24, 0x34, 0x44, 0x24, 0x44, 0x14, 0x11,
+	0x24, 0x14, 0x27, 0x13, 0x35, // U+0062 (b)
+	0xF0, 0xF0, 0xF0, 0x66, 0x4A, 0x24, 0x29, 0x57, 0x84, 0x84, 0x53, 0x14, 0x25, 0x1A, 0x46, // U+0063 (c)
+	0x65, 0x96, 0x95, 0xA4, 0xA4, 0x95, 0x59, 0x3B, 0x34, 0x25, 0x24, 0x44, 0x24, 0x44, 0x34, 0x21,
+	0x14, 0x27, 0x24, 0x35, 0x33, // U+0064 (d)
+	0xF0, 0xF0, 0xF0, 0x66, 0x4A, 0x23, 0x43, 0x14, 0x4F, 0x0C, 0x14, 0x93, 0x99, 0x57, // U+0065 (e)
+	0x54, 0x68, 0x43, 0x24, 0x24, 0x33, 0x24, 0x76, 0x58, 0x48, 0x56, 0x74, 0x84, 0x76, 0x58, 0x48, // U+0066 (f)
+	0xF0, 0xF0, 0xF0, 0xE5, 0x33, 0x17, 0x24, 0x14, 0x21, 0x14, 0x14, 0x44, 0x24, 0x44, 0x34, 0x25,
+	0x3B, 0x59, 0xA4, 0xA3, 0x3B, 0x39, // U+0067 (g)
+	0x05, 0x96, 0x95, 0xA4, 0xA4, 0x23, 0x54, 0x25, 0x36, 0x23, 0x36, 0x24, 0x25, 0x34, 0x24, 0x44,
+	0x24, 0x44, 0x15, 0x4A, 0x49, 0x62, // U+0068 (h)
+	0x24, 0x44, 0xF0, 0x35, 0x36, 0x35, 0x44, 0x44, 0x44, 0x44, 0x36, 0x1F, 0x01, // U+0069 (i)
+	0x84, 0x84, 0xF0, 0xF0, 0x32, 0x94, 0x84, 0x84, 0x84, 0x84, 0x12, 0x58, 0x48, 0x44, 0x14, 0x24,
+	0x2A, 0x46, // U+006A (j)
+	0x05, 0x96, 0x95, 0xA4, 0xA4, 0x53, 0x24, 0x35, 0x24, 0x34, 0x34, 0x23, 0x58, 0x68, 0x64, 0x23,
+	0x45, 0x34, 0x16, 0x3A, 0x63, // U+006B (k)
+	0x05, 0x36, 0x35, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x36, 0x1F, 0x01, // U+006C (l)
+	0xF0, 0xF0, 0xF0, 0xC2, 0x62, 0x35, 0x26, 0x1D, 0x1F, 0x0F, 0x0F, 0x01, 0x22, 0x28, 0x22, 0x28,
+	0x64, 0x12, 0x82, // U+006D (m)
+	0xF0, 0xF0, 0xF0, 0x48, 0x3B, 0x15, 0x24, 0x14, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x12, 0x62, // U+006E (n)
+	0xF0, 0xF0, 0xF0, 0x66, 0x4A, 0x24, 0x24, 0x14, 0x48, 0x48, 0x48, 0x44, 0x14, 0x24, 0x2A, 0x46, // U+006F (o)
+	0xF0, 0xF0, 0xF0, 0xB3, 0x35, 0x34, 0x27, 0x24, 0x11, 0x24, 0x34, 0x44, 0x24, 0x44, 0x25, 0x24,
+	0x3B, 0x39, 0x54, 0x95, 0x88, 0x68, // U+0070 (p)
+	0xF0, 0xF0, 0xF0, 0xE5, 0x33, 0x17, 0x24, 0x14, 0x21, 0x14, 0x14, 0x44, 0x24, 0x44, 0x34, 0x25,
+	0x3B, 0x59, 0xA4, 0xA5, 0x78, 0x68, // U+0071 (q)
+	0xF0, 0xF0, 0xF0, 0xB3, 0x44, 0x34, 0x27, 0x27, 0x23, 0x35, 0x34, 0x25, 0x34, 0x24, 0x52, 0x34,
+	0x96, 0x78, 0x68, // U+0072 (r)
+	0xF0, 0xF0, 0xF0, 0x69, 0x1F, 0x84, 0x98, 0x68, 0x94, 0x8F, 0x19, // U+0073 (s)
+	0x42, 0x73, 0x73, 0x56, 0x3F, 0x05, 0x16, 0x54, 0x64, 0x64, 0x64, 0x22, 0x33, 0x22, 0x36, 0x63, // U+0074 (t)
+	0xF0, 0xF0, 0xF0, 0xC2, 0x62, 0x34, 0x44, 0x24, 0x44, 0x24, 0x44, 0x24, 0x44, 0x24, 0x44, 0x24,
+	0x44, 0x34, 0x21, 0x14, 0x27, 0x24, 0x35, 0x33, // U+0075 (u)
+	0xF0, 0xF0, 0xF0, 0x42, 0x62, 0x14, 0x48, 0x48, 0x48, 0x44, 0x14, 0x24, 0x2A, 0x46, 0x66, 0x82, // U+0076 (v)
+	0xF0, 0xF0, 0xF0, 0xC2, 0x82, 0x14, 0x68, 0x22, 0x28, 0x22, 0x2F, 0x0F, 0x0F, 0x01, 0x1C, 0x25,
+	0x25, 0x42, 0x42, // U+0077 (w)
+	0xF0, 0xF0, 0xF0, 0xB3, 0x88, 0x45, 0x14, 0x44, 0x43, 0x23, 0x76, 0x86, 0x73, 0x23, 0x44, 0x44,
+	0x15, 0x48, 0x83, // U+0078 (x)
+	0xF0, 0xF0, 0xF0, 0x42, 0x62, 0x14, 0x48, 0x48, 0x48, 0x44, 0x14, 0x25, 0x1B, 0x39, 0x84, 0x83,
+	0x1B, 0x19, // U+0079 (y)
+	0xF0, 0xF0, 0xF0, 0x4F, 0x0B, 0x35, 0x12, 0x43, 0x84, 0x64, 0x83, 0x42, 0x15, 0x3F, 0x0B, // U+007A (z)
+	0x75, 0x57, 0x54, 0x74, 0x84, 0x74, 0x56, 0x66, 0x94, 0x94, 0x84, 0x94, 0x87, 0x75, // U+007B ({)
+	0x12, 0x1F, 0x01, 0x12, 0xA2, 0x1F, 0x01, 0x12, // U+007C (|)
+	0x05, 0x77, 0x84, 0x94, 0x84, 0x94, 0x96, 0x66, 0x54, 0x74, 0x84, 0x74, 0x57, 0x55, // U+007D (})
+	0x34, 0x43, 0x17, 0x28, 0x27, 0x13, 0x44, // U+007E (~)
+	0x24, 0x36, 0x13, 0x25, 0x44, 0x45, 0x23, 0x16, 0x34, // U+00B0 (degree)
+};
+
+static const ssd1306_glyph_t font_medium_glyphs[FONT_GLYPHS] = {
+	{ 0, 6, 0 }, { 0, 8, 13 }, { 13, 10, 7 }, { 20, 14, 24 }, { 44, 12, 12 }, { 56, 14, 17 },
+	{ 73, 14, 24 }, { 97, 6, 6 }, { 103, 8, 14 }, { 117, 8, 14 }, { 131, 16, 17 },
+	{ 148, 12, 11 }, { 159, 6, 10 }, { 169, 12, 6 }, { 175, 4, 5 }, { 180, 14, 14 },
+	{ 194, 14, 18 }, { 212, 14, 14 }, { 226, 14, 18 }, { 244, 14, 18 }, { 262, 14, 18 },
+	{ 280, 14, 16 }, { 296, 14, 18 }, { 314, 14, 16 }, { 330, 14, 22 }, { 352, 14, 18 },
+	{ 370, 4, 7 }, { 377, 6, 11 }, { 388, 10, 14 }, { 402, 12, 10 }, { 412, 10, 14 },
+	{ 426, 12, 16 }, { 442, 14, 16 }, { 458, 12, 17 }, { 475, 14, 22 }, { 497, 14, 18 },
+	{ 515, 14, 24 }, { 539, 14, 21 }, { 560, 14, 20 }, { 580, 14, 20 }, { 600, 12, 17 },
+	{ 617, 8, 14 }, { 631, 14, 18 }, { 649, 14, 24 }, { 673, 14, 18 }, { 691, 14, 19 },
+	{ 710, 14, 17 }, { 727, 14, 21 }, { 748, 14, 18 }, { 766, 12, 17 }, { 783, 14, 22 },
+	{ 805, 12, 14 }, { 819, 12, 16 }, { 835, 12, 16 }, { 851, 12, 17 }, { 868, 14, 19 },
+	{ 887, 14, 22 }, { 909, 12, 17 }, { 926, 14, 21 }, { 947, 8, 13 }, { 960, 14, 14 },
+	{ 974, 8, 13 }, { 987, 14, 11 }, { 998, 16, 17 }, { 1015, 6, 6 }, { 1021, 14, 17 },
+	{ 1038, 14, 21 }, { 1059, 12, 15 }, { 1074, 14, 21 }, { 1095, 12, 14 }, { 1109, 12, 16 },
+	{ 1125, 14, 22 }, { 1147, 14, 22 }, { 1169, 8, 13 }, { 1182, 12, 18 }, { 1200, 14, 21 },
+	{ 1221, 8, 14 }, { 1235, 14, 19 }, { 1254, 12, 16 }, { 1270, 12, 16 }, { 1286, 14, 22 },
+	{ 1308, 14, 22 }, { 1330, 14, 19 }, { 1349, 12, 11 }, { 1360, 10, 16 }, { 1376, 14, 24 },
+	{ 1400, 12, 16 }, { 1416, 14, 19 }, { 1435, 14, 19 }, { 1454, 12, 18 }, { 1472, 12, 15 },
+	{ 1487, 12, 14 }, { 1501, 4, 8 }, { 1509, 12, 14 }, { 1523, 14, 7 }, { 1530, 8, 9 },
+};
+
+// 24 px high, 3 pages: 5211 bytes of glyph columns packed into 2590
+static const uint8_t font_large_data[2590] = {
+	// U+0020 ( )
+	0x52, 0x86, 0x58, 0x3A, 0x2A, 0x1F, 0x09, 0x1A, 0x2A, 0x38, 0x48, 0x56, 0x66, 0x74, 0x92, 0xF0,
+	0xF0, 0xE6, 0x66, 0x66, // U+0021 (!)
+	0x22, 0x72, 0x34, 0x54, 0x16, 0x3C, 0x36, 0x14, 0x54, 0x32, 0x72, // U+0022 (")
+	0x52, 0x72, 0x94, 0x54, 0x76, 0x36, 0x66, 0x36, 0x57, 0x37, 0x47, 0x37, 0x2F, 0x0F, 0x0F, 0x0F,
+	0x03, 0x36, 0x36, 0x66, 0x36, 0x66, 0x36, 0x3F, 0x0F, 0x0F, 0x0F, 0x03, 0x27, 0x37, 0x47, 0x37,
+	0x56, 0x36, 0x66, 0x36, 0x74, 0x54, 0x92, 0x72, // U+0023 (#)
+	0x82, 0xE6, 0xB9, 0x8E, 0x3F, 0x2F, 0x07, 0xC6, 0xC6, 0xEB, 0x8C, 0x8B, 0xE6, 0xC6, 0xCF, 0x07,
+	0x2F, 0x3E, 0x89, 0xB6, 0xE2, // U+0024 ($)
+	0xF0, 0xF0, 0xF0, 0xF0, 0x52, 0xD4, 0x14, 0xAC, 0x8D, 0x76, 0x34, 0x76, 0x52, 0x76, 0xE6, 0xE6,
+	0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0x72, 0x56, 0x74, 0x36, 0x7D, 0x8C, 0xA4, 0x14, 0xD2, // U+0025 (%)
+	0x85, 0xE9, 0xBB, 0x86, 0x36, 0x66, 0x36, 0x66, 0x36, 0x99, 0xC9, 0xC8, 0xB8, 0x54, 0x39, 0x36,
+	0x2A, 0x36, 0x15, 0x3A, 0x35, 0x3A, 0x26, 0x48, 0x36, 0x66, 0x46, 0x57, 0x37, 0x56, 0x4A, 0x36,
+	0x39, 0x36, 0x57, 0x54, // U+0026 (&)
+	0x52, 0x64, 0x46, 0x36, 0x26, 0x36, 0x17, 0x26, 0x34, // U+0027 (')
+	0x84, 0x66, 0x57, 0x46, 0x56, 0x56, 0x56, 0x66, 0x56, 0x66, 0x66, 0x66, 0x66, 0x76, 0x66, 0x76,
+	0x76, 0x76, 0x77, 0x66, 0x84, // U+0028 (()
+	0x04, 0x86, 0x67, 0x76, 0x76, 0x76, 0x76, 0x66, 0x76, 0x66, 0x66, 0x66, 0x66, 0x56, 0x66, 0x56,
+	0x56, 0x56, 0x47, 0x56, 0x64, // U+0029 ())
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF4, 0xA4, 0x66, 0x66, 0x68, 0x28, 0x9C, 0xCC, 0xCC, 0x6F, 0x0F, 0x0F,
+	0x0F, 0x0C, 0x6C, 0xCC, 0xCC, 0x98, 0x28, 0x66, 0x66, 0x64, 0xA4, // U+002A (*)
+	0xF0, 0xF0, 0xF0, 0xF0, 0x22, 0xF4, 0xD6, 0xC6, 0xB8, 0x9A, 0x4F, 0x0F, 0x0F, 0x09, 0x4A, 0x98,
+	0xB6, 0xC6, 0xD4, 0xF2, // U+002B (+)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x52, 0x64, 0x46, 0x36, 0x26, 0x36, 0x17,
+	0x26, 0x34, // U+002C (,)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xCF, 0x0F, 0x0F, 0x09, // U+002D (-)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x22, 0x34, 0x1C, 0x14, 0x32, // U+002E (.)
+	0xF0, 0x24, 0xF6, 0xE7, 0xD6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+	0xE6, 0xF5, 0xF5, 0xF0, 0x14, 0xF0, 0x23, 0xF0, 0x33, // U+002F (/)
+	0x5B, 0x8F, 0x5F, 0x02, 0x37, 0x75, 0x26, 0x85, 0x16, 0x9C, 0x7E, 0x6F, 0x5F, 0x01, 0x4F, 0x02,
+	0x3F, 0x03, 0x3F, 0x09, 0x3F, 0x03, 0x3F, 0x02, 0x4F, 0x66, 0x18, 0x56, 0x28, 0x47, 0x3F, 0x02,
+	0x5F, 0x8B, // U+0030 (0)
+	0x92, 0xF0, 0x25, 0xF7, 0xC9, 0xC9, 0xC9, 0xE7, 0xE7, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6,
+	0xF6, 0xE8, 0xCA, 0x7F, 0x03, 0x3F, 0x03, 0x3F, 0x03, // U+0031 (1)
+	0x68, 0xBC, 0x8E, 0x58, 0x27, 0x46, 0x56, 0x44, 0x86, 0xF6, 0xE6, 0xE7, 0xC8, 0xB9, 0xB8, 0xC7,
+	0xD6, 0xE6, 0xE5, 0x82, 0x65, 0x65, 0x46, 0x48, 0x3F, 0x03, 0x4F, 0x01, 0x6E, // U+0032 (2)
+	0x68, 0xBC, 0x8E, 0x58, 0x27, 0x46, 0x56, 0x44, 0x86, 0xF6, 0xE6, 0xE7, 0xA9, 0xC9, 0xC9, 0xF0,
+	0x17, 0xF6, 0xF0, 0x16, 0x34, 0x86, 0x36, 0x56, 0x48, 0x27, 0x6E, 0x8C, 0xB8, // U+0033 (3)
+	0xB5, 0xE8, 0xCA, 0xAB, 0x9C, 0x8D, 0x75, 0x36, 0x66, 0x36, 0x56, 0x46, 0x45, 0x66, 0x45, 0x58,
+	0x26, 0x49, 0x2F, 0x06, 0x1F, 0x05, 0x2F, 0x04, 0xC6, 0xF6, 0xF6, 0xCC, 0x9C, 0x9C, // U+0034 (4)
+	0x3F, 0x01, 0x4F, 0x02, 0x3F, 0x03, 0x36, 0xF6, 0xF6, 0xFD, 0x9E, 0x8E, 0xF7, 0xF6, 0xF0, 0x16,
+	0xF6, 0xF6, 0xF6, 0x34, 0x86, 0x36, 0x56, 0x48, 0x27, 0x6E, 0x8C, 0xB8, // U+0035 (5)
+	0x97, 0xC9, 0xBA, 0xA7, 0xD6, 0xE6, 0xE5, 0xF0, 0x15, 0xF6, 0xFD, 0x8F, 0x6F, 0x01, 0x58, 0x27,
+	0x47, 0x46, 0x46, 0x66, 0x36, 0x66, 0x46, 0x46, 0x57, 0x27, 0x6E, 0x8C, 0xB8, // U+0036 (6)
+	0x3E, 0x6F, 0x01, 0x4F, 0x03, 0x38, 0x28, 0x45, 0x57, 0x52, 0x86, 0xF6, 0xE6, 0xF6, 0xE6, 0xE6,
+	0xE6, 0xE6, 0xF6, 0xE6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF0, 0x14, 0xF0, 0x32, // U+0037 (7)
+	0x68, 0xBC, 0x8E, 0x67, 0x27, 0x56, 0x46, 0x46, 0x66, 0x36, 0x66, 0x46, 0x46, 0x57, 0x27, 0x7C,
+	0x9C, 0x9C, 0x77, 0x27, 0x56, 0x46, 0x46, 0x66, 0x36, 0x66, 0x46, 0x46, 0x57, 0x27, 0x6E, 0x8C,
+	0xB8, // U+0038 (8)
+	0x68, 0xBC, 0x8E, 0x67, 0x27, 0x56, 0x46, 0x46, 0x66, 0x36, 0x66, 0x46, 0x47, 0x47, 0x28, 0x5F,
+	0x01, 0x6F, 0x8D, 0xF6, 0xF5, 0xF0, 0x15, 0xE6, 0xE6, 0xD7, 0xAA, 0xB9, 0xC7, // U+0039 (9)
+	0xF0, 0x52, 0x34, 0x1C, 0x14, 0x32, 0xF0, 0xF0, 0xA2, 0x34, 0x1C, 0x14, 0x32, // U+003A (:)
+	0xF0, 0xF0, 0x22, 0x64, 0x46, 0x36, 0x44, 0x62, 0xF0, 0xF0, 0xF0, 0xF0, 0x12, 0x64, 0x46, 0x36,
+	0x26, 0x36, 0x17, 0x26, 0x34, // U+003B (;)
+	0xB4, 0x96, 0x87, 0x76, 0x86, 0x86, 0x86, 0x86, 0x86, 0x76, 0x96, 0x96, 0xB6, 0xA6, 0xA6, 0xA6,
+	0xA6, 0xA6, 0xA7, 0x96, 0xB4, // U+003C (<)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x3F, 0x0F, 0x0F, 0x09, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0x3F, 0x0F, 0x0F, 0x09, // U+003D (=)
+	0x04, 0xB6, 0x97, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xB6, 0x96, 0x96, 0x76, 0x86, 0x86, 0x86,
+	0x86, 0x86, 0x77, 0x86, 0x94, // U+003E (>)
+	0x58, 0x8C, 0x5E, 0x28, 0x27, 0x16, 0x56, 0x14, 0x86, 0xC6, 0xB6, 0xC6, 0xB6, 0xB6, 0xB6, 0xA7,
+	0xB6, 0xC4, 0xF0, 0xF0, 0xF0, 0xF0, 0x86, 0xC6, 0xC6, // U+003F (?)
+	0x5B, 0x8F, 0x5F, 0x02, 0x37, 0x75, 0x26, 0x85, 0x16, 0x9C, 0x5F, 0x01, 0x4F, 0x02, 0x3F, 0x03,
+	0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x4A, 0x16, 0x58, 0x26, 0xF0, 0x16, 0xF7, 0xFD,
+	0x9C, 0xBA, // U+0040 (@)
+	0x82, 0xE6, 0xB8, 0x9A, 0x7C, 0x5E, 0x37, 0x27, 0x26, 0x46, 0x16, 0x6C, 0x6D, 0x4F, 0x2F, 0x0F,
+	0x0F, 0x0F, 0x0A, 0x2F, 0x4D, 0x6C, 0x66, 0x14, 0x84, 0x32, 0xA2, // U+0041 (A)
+	0x0F, 0x01, 0x5F, 0x03, 0x3F, 0x04, 0x49, 0x27, 0x38, 0x46, 0x46, 0x66, 0x36, 0x66, 0x37, 0x46,
+	0x48, 0x27, 0x4F, 0x6F, 0x6F, 0x68, 0x27, 0x47, 0x46, 0x46, 0x66, 0x36, 0x66, 0x28, 0x46, 0x39,
+	0x27, 0x1F, 0x04, 0x2F, 0x03, 0x3F, 0x01, // U+0042 (B)
+	0x88, 0xBC, 0x8E, 0x67, 0x28, 0x36, 0x66, 0x26, 0x94, 0x16, 0xF6, 0xE6, 0xF6, 0xF6, 0xF6, 0xF6,
+	0xF0, 0x16, 0xF6, 0xF0, 0x16, 0x94, 0x36, 0x66, 0x47, 0x28, 0x5E, 0x8C, 0xB8, // U+0043 (C)
+	0x0D, 0x8F, 0x6F, 0x01, 0x77, 0x35, 0x67, 0x36, 0x66, 0x46, 0x56, 0x56, 0x46, 0x56, 0x46, 0x66,
+	0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x56, 0x46, 0x56, 0x46, 0x46, 0x47, 0x36,
+	0x57, 0x35, 0x4F, 0x01, 0x5F, 0x6D, // U+0044 (D)
+	0x0F, 0x04, 0x2F, 0x05, 0x1F, 0x06, 0x29, 0x55, 0x28, 0x83, 0x36, 0x93, 0x36, 0x33, 0x96, 0x33,
+	0x96, 0x33, 0x9C, 0x9C, 0x9C, 0x96, 0x33, 0x96, 0x33, 0x96, 0x33, 0x96, 0x93, 0x28, 0x83, 0x29,
+	0x5F, 0x0F, 0x0F, 0x01, 0x1F, 0x04, // U+0045 (E)
+	0x0F, 0x04, 0x2F, 0x05, 0x1F, 0x06, 0x29, 0x55, 0x28, 0x83, 0x36, 0x93, 0x36, 0x33, 0x96, 0x33,
+	0x96, 0x33, 0x9C, 0x9C, 0x9C, 0x96, 0x33, 0x96, 0x33, 0x96, 0x33, 0x96, 0xE8, 0xD8, 0xBC, 0x9C,
+	0x9C, // U+0046 (F)
+	0x88, 0xBC, 0x8E, 0x67, 0x28, 0x36, 0x66, 0x26, 0x94, 0x16, 0xF6, 0xE6, 0xF6, 0xF6, 0xF6, 0xF6,
+	0x67, 0x36, 0x58, 0x26, 0x59, 0x26, 0x76, 0x36, 0x66, 0x47, 0x46, 0x5F, 0x01, 0x6E, 0x9B, // U+0047 (G)
+	0x22, 0xA2, 0x34, 0x84, 0x16, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x4F, 0x2F, 0x0F, 0x0F, 0x0F, 0x0A,
+	0x2F, 0x4D, 0x6C, 0x6C, 0x6C, 0x6C, 0x66, 0x14, 0x84, 0x32, 0xA2, // U+0048 (H)
+	0x0F, 0x0F, 0x06, 0x28, 0x48, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x58, 0x48, 0x2F, 0x0F, 0x06, // U+0049 (I)
+	0x9C, 0x9C, 0x9C, 0xB8, 0xD8, 0xE6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0x52, 0x86, 0x44, 0x76,
+	0x36, 0x66, 0x36, 0x66, 0x46, 0x46, 0x57, 0x27, 0x6E, 0x8C, 0xB8, // U+004A (J)
+	0x07, 0xA2, 0x28, 0x84, 0x19, 0x66, 0x27, 0x66, 0x27, 0x56, 0x46, 0x56, 0x46, 0x46, 0x56, 0x36,
+	0x66, 0x35, 0x7C, 0x9C, 0x9C, 0x96, 0x35, 0x76, 0x36, 0x66, 0x46, 0x56, 0x56, 0x37, 0x56, 0x37,
+	0x6F, 0x6E, 0x84, 0x17, 0xA2, // U+004B (K)
+	0x0C, 0x9C, 0x9C, 0xB8, 0xD8, 0xE6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0x93, 0x36, 0x93,
+	0x36, 0x84, 0x36, 0x75, 0x28, 0x56, 0x29, 0x2F, 0x0F, 0x0F, 0x04, 0x1F, 0x04, // U+004C (L)
+	0x22, 0xD2, 0x35, 0x95, 0x17, 0x7F, 0x5F, 0x02, 0x3F, 0x03, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x06, 0x33, 0x3C, 0x33, 0x3C, 0x33, 0x3C, 0x9C, 0x9C, 0x9C, 0x96, 0x14, 0xB4,
+	0x32, 0xD2, // U+004D (M)
+	0x22, 0xD2, 0x35, 0xA4, 0x17, 0x8E, 0x7F, 0x6F, 0x01, 0x5F, 0x02, 0x4F, 0x03, 0x3F, 0x03, 0x3C,
+	0x3F, 0x03, 0x3F, 0x03, 0x4F, 0x02, 0x5F, 0x01, 0x6F, 0x7E, 0x8D, 0x8D, 0x9C, 0x96, 0x14, 0xB4,
+	0x32, 0xD2, // U+004E (N)
+	0x85, 0xE9, 0xBB, 0x95, 0x35, 0x76, 0x36, 0x56, 0x56, 0x36, 0x76, 0x26, 0x76, 0x16, 0x9C, 0x9C,
+	0x9C, 0x9C, 0x96, 0x16, 0x76, 0x26, 0x76, 0x36, 0x56, 0x56, 0x36, 0x75, 0x35, 0x9B, 0xB9, 0xE5, // U+004F (O)
+	0x0F, 0x01, 0x5F, 0x03, 0x3F, 0x04, 0x49, 0x27, 0x38, 0x46, 0x46, 0x66, 0x36, 0x66, 0x37, 0x46,
+	0x48, 0x27, 0x4F, 0x01, 0x5F, 0x6D, 0x88, 0xD7, 0xE6, 0xF6, 0xE8, 0xD8, 0xBC, 0x9C, 0x9C, // U+0050 (P)
+	0x58, 0x8C, 0x5E, 0x37, 0x27, 0x26, 0x46, 0x16, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x5D, 0x5D, 0x48,
+	0x15, 0x38, 0x25, 0x38, 0x3D, 0x6C, 0x8A, 0xAB, 0x99, 0xB7, // U+0051 (Q)
+	0x0F, 0x01, 0x5F, 0x03, 0x3F, 0x04, 0x49, 0x27, 0x38, 0x46, 0x46, 0x66, 0x36, 0x66, 0x37, 0x46,
+	0x48, 0x27, 0x4F, 0x01, 0x5F, 0x01, 0x5F, 0x66, 0x36, 0x66, 0x37, 0x56, 0x46, 0x56, 0x56, 0x37,
+	0x56, 0x37, 0x6F, 0x6E, 0x84, 0x17, 0xA2, // U+0052 (R)
+	0x58, 0x8C, 0x5E, 0x35, 0x48, 0x15, 0x6C, 0x8C, 0xB8, 0xA9, 0xA9, 0xA9, 0xB9, 0xB9, 0xB8, 0xBC,
+	0x8C, 0x65, 0x18, 0x45, 0x3E, 0x5C, 0x88, // U+0053 (S)
+	0x2E, 0x3F, 0x01, 0x1F, 0x06, 0x36, 0x36, 0x36, 0x36, 0x36, 0x33, 0x66, 0xC6, 0xC6, 0xC6, 0xC6,
+	0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xB8, 0xA8, 0x8C, 0x6C, 0x6C, // U+0054 (T)
+	0x22, 0xA2, 0x34, 0x84, 0x16, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+	0x6C, 0x6C, 0x6D, 0x4F, 0x2F, 0x0B, 0x1F, 0x01, 0x3E, // U+0055 (U)
+	0x22, 0xA2, 0x34, 0x84, 0x16, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x66,
+	0x16, 0x46, 0x27, 0x27, 0x3E, 0x5C, 0x7A, 0x98, 0xB6, 0xE2, // U+0056 (V)
+	0x22, 0xD2, 0x34, 0xB4, 0x16, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x33, 0x3C, 0x33, 0x3C,
+	0x33, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x3F, 0x03, 0x3F, 0x02, 0x5F, 0x77, 0x15, 0x95, 0x32,
+	0xD2, // U+0057 (W)
+	0x22, 0xD2, 0x34, 0xB4, 0x16, 0x9C, 0x96, 0x16, 0x76, 0x26, 0x76, 0x36, 0x56, 0x56, 0x36, 0x75,
+	0x35, 0x9B, 0xAB, 0xB9, 0xC9, 0xBB, 0xAB, 0x95, 0x35, 0x76, 0x36, 0x56, 0x56, 0x27, 0x7D, 0x9A,
+	0xD4, // U+0058 (X)
+	0x22, 0xA2, 0x34, 0x84, 0x16, 0x6C, 0x6C, 0x6C, 0x6C, 0x66, 0x16, 0x46, 0x27, 0x27, 0x3E, 0x5C,
+	0x7A, 0x98, 0xA8, 0xB6, 0xC6, 0xB8, 0xA8, 0x8C, 0x6C, 0x6C, // U+0059 (Y)
+	0x2F, 0x02, 0x3F, 0x04, 0x1F, 0x0E, 0x7C, 0x95, 0x15, 0xA5, 0x14, 0x96, 0x23, 0x96, 0x33, 0x86,
+	0xE6, 0xE6, 0xE6, 0xE6, 0x53, 0x66, 0x63, 0x56, 0x64, 0x45, 0x75, 0x36, 0x66, 0x27, 0x4F, 0x0F,
+	0x0F, 0x04, 0x1F, 0x04, // U+005A (Z)
+	0x2A, 0x1F, 0x0F, 0x01, 0x47, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x67, 0x58, 0x4C, 0x1B, 0x2A, // U+005B ([)
+	0x04, 0xF0, 0x26, 0xF7, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16,
+	0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x16, 0xF0, 0x15,
+	0xF0, 0x25, 0xF0, 0x24, 0xF0, 0x33, 0xF0, 0x33, // U+005C (\)
+	0x0A, 0x2B, 0x1C, 0x48, 0x57, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x57, 0x4F, 0x0F, 0x01, 0x1A, // U+005D (])
+	0x93, 0xF0, 0x33, 0xF0, 0x25, 0xF7, 0xD9, 0xBB, 0x95, 0x35, 0x76, 0x36, 0x56, 0x56, 0x27, 0x7D,
+	0x9A, 0xD4, // U+005E (^)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	0xF0, 0x9F, 0x0F, 0x0F, 0x0F, 0x0C, // U+005F (_)
+	0x22, 0x64, 0x46, 0x36, 0x46, 0x36, 0x47, 0x36, 0x54, // U+0060 (`)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x9A, 0xBC, 0x9D, 0xF0, 0x25, 0xF0, 0x15, 0xF0,
+	0x16, 0x8D, 0x6F, 0x5F, 0x01, 0x36, 0x66, 0x36, 0x67, 0x26, 0x76, 0x4A, 0x36, 0x39, 0x36, 0x57,
+	0x54, // U+0061 (a)
+	0x07, 0xE8, 0xD9, 0xE7, 0xE7, 0xF6, 0xF6, 0xF7, 0xE8, 0xDD, 0x8F, 0x6F, 0x01, 0x58, 0x27, 0x47,
+	0x46, 0x46, 0x66, 0x36, 0x66, 0x26, 0x11, 0x46, 0x36, 0x12, 0x27, 0x16, 0x3A, 0x26, 0x39, 0x34,
+	0x57, // U+0062 (b)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x88, 0x8C, 0x5E, 0x37, 0x28, 0x16, 0x5C, 0x8A, 0xC6,
+	0xC6, 0xC6, 0x84, 0x16, 0x56, 0x17, 0x28, 0x2E, 0x5C, 0x88, // U+0063 (c)
+	0x97, 0xE8, 0xD9, 0xE7, 0xE7, 0xF6, 0xF6, 0xE7, 0xD8, 0x8D, 0x6F, 0x5F, 0x01, 0x47, 0x28, 0x46,
+	0x47, 0x36, 0x66, 0x36, 0x66, 0x46, 0x41, 0x16, 0x37, 0x22, 0x16, 0x4A, 0x36, 0x39, 0x36, 0x57,
+	0x54, // U+0064 (d)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x88, 0x8C, 0x5E, 0x35, 0x65, 0x25, 0x65, 0x16, 0x6F,
+	0x0F, 0x0B, 0x1F, 0x01, 0x26, 0xD5, 0xD5, 0xED, 0x6C, 0x8A, // U+0065 (e)
+	0x85, 0xB9, 0x8B, 0x65, 0x36, 0x45, 0x36, 0x36, 0x54, 0x36, 0xB8, 0xA8, 0x8C, 0x6C, 0x6C, 0x88,
+	0xA8, 0xB6, 0xC6, 0xB8, 0xA8, 0x8C, 0x6C, 0x6C, // U+0066 (f)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB7, 0x54, 0x39, 0x36, 0x2A, 0x36, 0x17, 0x22,
+	0x16, 0x36, 0x41, 0x16, 0x26, 0x66, 0x36, 0x66, 0x46, 0x47, 0x47, 0x28, 0x5F, 0x01, 0x6F, 0x8D,
+	0xF6, 0xF5, 0xF0, 0x15, 0x4F, 0x01, 0x5F, 0x6D, // U+0067 (g)
+	0x07, 0xE8, 0xD9, 0xE7, 0xE7, 0xF6, 0xF6, 0x34, 0x86, 0x36, 0x66, 0x37, 0x59, 0x35, 0x49, 0x35,
+	0x49, 0x36, 0x37, 0x56, 0x37, 0x56, 0x36, 0x66, 0x36, 0x66, 0x27, 0x66, 0x27, 0x6F, 0x6E, 0x84,
+	0x17, 0xA2, // U+0068 (h)
+	0x36, 0x66, 0x66, 0xF0, 0xF0, 0x97, 0x58, 0x49, 0x57, 0x57, 0x66, 0x66, 0x66, 0x66, 0x66, 0x58,
+	0x48, 0x2F, 0x0F, 0x06, // U+0069 (i)
+	0xC6, 0xC6, 0xC6, 0xF0, 0xF0, 0xF0, 0xF0, 0x82, 0xF4, 0xD6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+	0x22, 0x86, 0x14, 0x7C, 0x6C, 0x66, 0x16, 0x46, 0x27, 0x27, 0x3E, 0x5C, 0x88, // U+006A (j)
+	0x07, 0xE8, 0xD9, 0xE7, 0xE7, 0xF6, 0xF6, 0x84, 0x36, 0x66, 0x36, 0x57, 0x36, 0x46, 0x56, 0x36,
+	0x66, 0x35, 0x7C, 0x9C, 0x9C, 0x96, 0x35, 0x67, 0x36, 0x57, 0x46, 0x29, 0x5F, 0x7D, 0xA4, // U+006B (k)
+	0x07, 0x58, 0x49, 0x57, 0x57, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x58, 0x48, 0x2F, 0x0F, 0x06, // U+006C (l)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x82, 0xA2, 0x65, 0x66, 0x38, 0x29, 0x2F, 0x05,
+	0x1F, 0x05, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x33, 0x3C, 0x33, 0x3C, 0x33, 0x3C, 0x96, 0x14,
+	0xB4, 0x32, 0xD2, // U+006D (m)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x5B, 0x6E, 0x3F, 0x01, 0x28, 0x27, 0x17, 0x46, 0x16,
+	0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x66, 0x14, 0x84, 0x32, 0xA2, // U+006E (n)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x88, 0x8C, 0x5E, 0x37, 0x27, 0x26, 0x46, 0x16, 0x6C,
+	0x6C, 0x6C, 0x6C, 0x66, 0x16, 0x46, 0x27, 0x27, 0x3E, 0x5C, 0x88, // U+006F (o)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x64, 0x57, 0x56, 0x39, 0x36, 0x3A, 0x46, 0x12,
+	0x27, 0x36, 0x11, 0x46, 0x46, 0x66, 0x36, 0x66, 0x37, 0x46, 0x48, 0x27, 0x4F, 0x01, 0x5F, 0x6D,
+	0x86, 0xE7, 0xE7, 0xCC, 0x9C, 0x9C, // U+0070 (p)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB7, 0x54, 0x39, 0x36, 0x2A, 0x36, 0x17, 0x22,
+	0x16, 0x36, 0x41, 0x16, 0x26, 0x66, 0x36, 0x66, 0x46, 0x47, 0x47, 0x28, 0x5F, 0x01, 0x6F, 0x8D,
+	0xF6, 0xF7, 0xE7, 0xBC, 0x9C, 0x9C, // U+0071 (q)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x64, 0x75, 0x56, 0x39, 0x36, 0x3A, 0x4A, 0x35,
+	0x3A, 0x35, 0x48, 0x46, 0x37, 0x56, 0x37, 0x64, 0x46, 0x82, 0x56, 0xE8, 0xD8, 0xBC, 0x9C, 0x9C, // U+0072 (r)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x8D, 0x3F, 0x2F, 0x07, 0xC6, 0xC6, 0xEB, 0x8C, 0x8B,
+	0xE6, 0xC6, 0xCF, 0x07, 0x2F, 0x3D, // U+0073 (s)
+	0x63, 0xC3, 0xB4, 0xA5, 0x97, 0x79, 0x4F, 0x0F, 0x0F, 0x29, 0x68, 0x86, 0x96, 0x96, 0x96, 0x96,
+	0x33, 0x45, 0x33, 0x45, 0x33, 0x58, 0x86, 0xB4, // U+0074 (t)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x82, 0xA2, 0x64, 0x84, 0x46, 0x66, 0x36, 0x66,
+	0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x46, 0x41, 0x16, 0x37,
+	0x22, 0x16, 0x4A, 0x36, 0x39, 0x36, 0x57, 0x54, // U+0075 (u)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x52, 0xA2, 0x34, 0x84, 0x16, 0x6C, 0x6C, 0x6C, 0x6C,
+	0x66, 0x16, 0x46, 0x27, 0x27, 0x3E, 0x5C, 0x7A, 0x98, 0xB6, 0xE2, // U+0076 (v)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x82, 0xD2, 0x34, 0xB4, 0x16, 0x9C, 0x33, 0x3C,
+	0x33, 0x3C, 0x33, 0x3F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x04, 0x2F, 0x04, 0x37, 0x37, 0x56,
+	0x36, 0x82, 0x72, // U+0077 (w)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x64, 0xDA, 0x9D, 0x77, 0x26, 0x56, 0x56, 0x36,
+	0x75, 0x35, 0xA9, 0xC9, 0xC9, 0xA5, 0x35, 0x76, 0x36, 0x56, 0x56, 0x27, 0x7D, 0x9A, 0xD4, // U+0078 (x)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x52, 0xA2, 0x34, 0x84, 0x16, 0x6C, 0x6C, 0x6C, 0x6C,
+	0x66, 0x16, 0x47, 0x17, 0x28, 0x2F, 0x01, 0x3F, 0x5D, 0xC6, 0xC5, 0xD5, 0x1F, 0x01, 0x2F, 0x3D, // U+0079 (y)
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x5F, 0x01, 0x1F, 0x0F, 0x0A, 0x47, 0x23, 0x66, 0x33,
+	0x65, 0xB6, 0xB6, 0xB6, 0xB5, 0x63, 0x36, 0x63, 0x27, 0x4F, 0x0F, 0x0A, 0x1F, 0x01, // U+007A (z)
+	0xB7, 0x99, 0x8A, 0x77, 0xB6, 0xB6, 0xC6, 0xB6, 0xB7, 0x79, 0x99, 0x99, 0xD7, 0xC6, 0xD6, 0xC6,
+	0xD6, 0xC7, 0xCA, 0x99, 0xB7, // U+007B ({)
+	0x22, 0x34, 0x1F, 0x0F, 0x14, 0x32, 0xF0, 0x72, 0x34, 0x1F, 0x0F, 0x14, 0x32, // U+007C (|)
+	0x07, 0xB9, 0x9A, 0xC7, 0xC6, 0xD6, 0xC6, 0xD6, 0xC7, 0xD9, 0x99, 0x99, 0x77, 0xB6, 0xB6, 0xC6,
+	0xB6, 0xB7, 0x7A, 0x89, 0x97, // U+007D (})
+	0x55, 0x74, 0x39, 0x36, 0x2A, 0x3C, 0x3A, 0x26, 0x39, 0x34, 0x75, // U+007E (~)
+	0x36, 0x66, 0x58, 0x25, 0x29, 0x47, 0x66, 0x67, 0x49, 0x25, 0x28, 0x56, 0x66, // U+00B0 (degree)
+};
+
+static const ssd1306_glyph_t font_large_glyphs[FONT_GLYPHS] = {
+	{ 0, 9, 0 }, { 0, 12, 20 }, { 20, 15, 11 }, { 31, 21, 40 }, { 71, 18, 21 },
+	{ 92, 21, 30 }, { 122, 21, 36 }, { 158, 9, 9 }, { 167, 12, 21 }, { 188, 12, 21 },
+	{ 209, 24, 27 }, { 236, 18, 20 }, { 256, 9, 18 }, { 274, 18, 14 }, { 288, 6, 11 },
+	{ 299, 21, 25 }, { 324, 21, 34 }, { 358, 21, 25 }, { 383, 21, 29 }, { 412, 21, 29 },
+	{ 441, 21, 30 }, { 471, 21, 28 }, { 499, 21, 29 }, { 528, 21, 28 }, { 556, 21, 33 },
+	{ 589, 21, 29 }, { 618, 6, 13 }, { 631, 9, 21 }, { 652, 15, 21 }, { 673, 18, 22 },
+	{ 695, 15, 21 }, { 716, 18, 25 }, { 741, 21, 34 }, { 775, 18, 27 }, { 802, 21, 39 },
+	{ 841, 21, 29 }, { 870, 21, 38 }, { 908, 21, 38 }, { 946, 21, 33 }, { 979, 21, 31 },
+	{ 1010, 18, 27 }, { 1037, 12, 21 }, { 1058, 21, 27 }, { 1085, 21, 37 }, { 1122, 21, 29 },
+	{ 1151, 21, 34 }, { 1185, 21, 34 }, { 1219, 21, 32 }, { 1251, 21, 31 }, { 1282, 18, 26 },
+	{ 1308, 21, 39 }, { 1347, 18, 23 }, { 1370, 18, 26 }, { 1396, 18, 25 }, { 1421, 18, 26 },
+	{ 1447, 21, 33 }, { 1480, 21, 33 }, { 1513, 18, 26 }, { 1539, 21, 36 }, { 1575, 12, 21 },
+	{ 1596, 21, 40 }, { 1636, 12, 21 }, { 1657, 21, 18 }, { 1675, 24, 38 }, { 1713, 9, 9 },
+	{ 1722, 21, 33 }, { 1755, 21, 33 }, { 1788, 18, 26 }, { 1814, 21, 33 }, { 1847, 18, 26 },
+	{ 1873, 18, 24 }, { 1897, 21, 40 }, { 1937, 21, 34 }, { 1971, 12, 20 }, { 1991, 18, 29 },
+	{ 2020, 21, 31 }, { 2051, 12, 21 }, { 2072, 21, 35 }, { 2107, 18, 28 }, { 2135, 18, 27 },
+	{ 2162, 21, 38 }, { 2200, 21, 38 }, { 2238, 21, 32 }, { 2270, 18, 22 }, { 2292, 15, 24 },
+	{ 2316, 21, 40 }, { 2356, 18, 27 }, { 2383, 21, 35 }, { 2418, 21, 31 }, { 2449, 18, 32 },
+	{ 2481, 18, 30 }, { 2511, 18, 21 }, { 2532, 6, 13 }, { 2545, 18, 21 }, { 2566, 21, 11 },
+	{ 2577, 12, 13 },
+};
+
+#endif /* MAIN_SSD1306_FONTS_H_ */
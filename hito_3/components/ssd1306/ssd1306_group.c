@@ -0,0 +1,123 @@
+#include <string.h>
+#include <inttypes.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+
+#include "ssd1306_group.h"
+#include "ssd1306_render.h"
+
+#define TAG "SSD1306"
+
+#define GROUP_STACK_SIZE 3072
+
+// Panel to flush now: pending, out of its frame-rate cap, highest priority,
+// and among equals the one that waited longest. *wait gets the ticks until
+// the next capped panel becomes due when none is.
+static ssd1306_group_panel_t * ssd1306_group_next(ssd1306_group_t * group, TickType_t now, TickType_t * wait)
+{
+	ssd1306_group_panel_t * best = NULL;
+	*wait = portMAX_DELAY;
+	for (int i=0;i<group->_count;i++) {
+		ssd1306_group_panel_t * panel = &group->_panels[i];
+		if (!panel->_pending) continue;
+		TickType_t elapsed = now - panel->_last;
+		if (elapsed < panel->_period) {
+			if (panel->_period - elapsed < *wait) *wait = panel->_period - elapsed;
+			continue;
+		}
+		if (best == NULL || panel->_priority > best->_priority ||
+			(panel->_priority == best->_priority && now - panel->_last > now - best->_last)) {
+			best = panel;
+		}
+	}
+	return best;
+}
+
+static void ssd1306_group_task(void * arg)
+{
+	ssd1306_group_t * group = arg;
+
+	while (1) {
+		TickType_t wait;
+		xSemaphoreTake(group->_lock, portMAX_DELAY);
+		ssd1306_group_panel_t * panel = ssd1306_group_next(group, xTaskGetTickCount(), &wait);
+		if (panel != NULL) {
+			ssd1306_render_move(panel->_dev, &panel->_front);
+			panel->_pending = false;
+		}
+		xSemaphoreGive(group->_lock);
+
+		if (panel == NULL) {
+			// Presents while choosing left a notification: no wake-up is lost
+			ulTaskNotifyTake(pdTRUE, wait);
+			continue;
+		}
+
+		// One panel per transfer, then choose again: a panel with higher
+		// priority presented meanwhile waits for this flush only
+		ssd1306_show_buffer(panel->_dev);
+		panel->_frames++;
+		panel->_last = xTaskGetTickCount();
+		ESP_LOGD(TAG, "group panel %d frame %"PRIu32"/%"PRIu32", %"PRIu32" bytes",
+			(int)(panel - group->_panels), panel->_frames, panel->_presents, ssd1306_get_flush_bytes(panel->_dev));
+	}
+}
+
+void ssd1306_group_init(ssd1306_group_t * group)
+{
+	memset(group, 0, sizeof(ssd1306_group_t));
+}
+
+// Add an initialized panel before ssd1306_group_start().
+// Returns the panel index for the canvas and present calls, or -1 when full.
+int ssd1306_group_add(ssd1306_group_t * group, SSD1306_t * dev, int priority, int max_fps)
+{
+	if (group->_count >= GROUP_MAX_PANELS) {
+		ESP_LOGE(TAG, "Panel group is full (%d panels)", GROUP_MAX_PANELS);
+		return -1;
+	}
+	ssd1306_group_panel_t * panel = &group->_panels[group->_count];
+	panel->_dev = dev;
+	ssd1306_init_offscreen(&panel->_back, dev);
+	ssd1306_init_offscreen(&panel->_front, dev);
+	panel->_priority = priority;
+	panel->_period = (max_fps > 0) ? pdMS_TO_TICKS(1000 / max_fps) : 0;
+	panel->_last = xTaskGetTickCount() - panel->_period;
+	panel->_pending = false;
+	panel->_presents = 0;
+	panel->_frames = 0;
+	return group->_count++;
+}
+
+esp_err_t ssd1306_group_start(ssd1306_group_t * group, UBaseType_t priority)
+{
+	group->_lock = xSemaphoreCreateMutex();
+	if (group->_lock == NULL) return ESP_ERR_NO_MEM;
+	if (xTaskCreate(ssd1306_group_task, "ssd1306_group", GROUP_STACK_SIZE, group, priority, &group->_task) != pdPASS) {
+		vSemaphoreDelete(group->_lock);
+		return ESP_ERR_NO_MEM;
+	}
+	ESP_LOGI(TAG, "Group task started, %d panels", group->_count);
+	return ESP_OK;
+}
+
+// Buffer the producer of this panel draws on. Only one task may draw on it.
+SSD1306_t * ssd1306_group_canvas(ssd1306_group_t * group, int panel)
+{
+	return &group->_panels[panel]._back;
+}
+
+// Hand the frame drawn so far to the group task without waiting for the bus
+void ssd1306_group_present(ssd1306_group_t * group, int panel)
+{
+	ssd1306_group_panel_t * p = &group->_panels[panel];
+	xSemaphoreTake(group->_lock, portMAX_DELAY);
+	ssd1306_render_move(&p->_front, &p->_back);
+	p->_pending = true;
+	p->_presents++;
+	xSemaphoreGive(group->_lock);
+	xTaskNotifyGive(group->_task);
+}
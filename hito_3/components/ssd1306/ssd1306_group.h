@@ -0,0 +1,53 @@
+#ifndef MAIN_SSD1306_GROUP_H_
+#define MAIN_SSD1306_GROUP_H_
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "ssd1306.h"
+
+// Render service for several panels sharing one bus (I2C addresses 0x3C and
+// 0x3D, or SPI devices with their own CS line).
+// Each panel has a back and a front buffer as in ssd1306_render. A single
+// task sends the dirty spans of one panel at a time, so the transfers never
+// compete for the bus. When several panels are due, the one with the highest
+// priority goes first, and equal priorities take turns. Each panel has its
+// own frame-rate cap, which also leaves bus time to lower priorities.
+#define GROUP_MAX_PANELS 3
+
+typedef struct {
+	SSD1306_t * _dev; // Panel, only written by the group task
+	SSD1306_t _back; // Drawn by the producer
+	SSD1306_t _front; // Last presented frame, waiting for the task
+	int _priority; // Higher is sent first
+	TickType_t _period; // Minimum time between flushes
+	TickType_t _last; // Tick of the last flush
+	bool _pending; // _front has changes the panel has not received
+	uint32_t _presents; // Frames presented
+	uint32_t _frames; // Frames sent to the panel
+} ssd1306_group_panel_t;
+
+typedef struct {
+	ssd1306_group_panel_t _panels[GROUP_MAX_PANELS];
+	int _count;
+	SemaphoreHandle_t _lock; // Guards the front buffers and _pending
+	TaskHandle_t _task;
+} ssd1306_group_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void ssd1306_group_init(ssd1306_group_t * group);
+int ssd1306_group_add(ssd1306_group_t * group, SSD1306_t * dev, int priority, int max_fps);
+esp_err_t ssd1306_group_start(ssd1306_group_t * group, UBaseType_t priority);
+SSD1306_t * ssd1306_group_canvas(ssd1306_group_t * group, int panel);
+void ssd1306_group_present(ssd1306_group_t * group, int panel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_GROUP_H_ */
@@ -1,10 +1,12 @@
 #include <string.h>
+#include <inttypes.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
 #include "driver/i2c.h"
 #include "esp_log.h"
+#include "soc/soc.h"
 
 #include "ssd1306.h"
 
@@ -80,70 +82,90 @@ void i2c_device_add(SSD1306_t * dev, i2c_port_t i2c_num, int16_t reset, uint16_t
 	dev->_i2c_num = i2c_num;
 }
 
+// Write one transaction: address, control byte, then data.
+// The command link is built on the stack, so no transfer path touches the heap.
+static esp_err_t i2c_write_control(SSD1306_t * dev, uint8_t control, const uint8_t * data, size_t length)
+{
+	uint8_t link_buf[I2C_LINK_RECOMMENDED_SIZE(1)] = { 0 };
+	i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(link_buf, sizeof(link_buf));
+	i2c_master_start(cmd);
+	i2c_master_write_byte(cmd, (dev->_address << 1) | I2C_MASTER_WRITE, true);
+	i2c_master_write_byte(cmd, control, true);
+	i2c_master_write(cmd, data, length, true);
+	i2c_master_stop(cmd);
+
+	esp_err_t res = i2c_master_cmd_begin(dev->_i2c_num, cmd, I2C_TICKS_TO_WAIT);
+	i2c_cmd_link_delete_static(cmd);
+	return res;
+}
+
+// out_buf[0] is the control byte, as in the new driver
+static esp_err_t i2c_write_stream(SSD1306_t * dev, const uint8_t * out_buf, size_t length)
+{
+	return i2c_write_control(dev, out_buf[0], &out_buf[1], length - 1);
+}
+
 void i2c_init(SSD1306_t * dev, int width, int height) {
 	dev->_width = width;
 	dev->_height = height;
 	dev->_pages = 8;
 	if (dev->_height == 32) dev->_pages = 4;
 	
-	i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-
-	i2c_master_start(cmd);
-	i2c_master_write_byte(cmd, (dev->_address << 1) | I2C_MASTER_WRITE, true);
-	i2c_master_write_byte(cmd, OLED_CONTROL_BYTE_CMD_STREAM, true);
-	i2c_master_write_byte(cmd, OLED_CMD_DISPLAY_OFF, true);				// AE
-	i2c_master_write_byte(cmd, OLED_CMD_SET_MUX_RATIO, true);			// A8
-	if (dev->_height == 64) i2c_master_write_byte(cmd, 0x3F, true);
-	if (dev->_height == 32) i2c_master_write_byte(cmd, 0x1F, true);
-	i2c_master_write_byte(cmd, OLED_CMD_SET_DISPLAY_OFFSET, true);		// D3
-	i2c_master_write_byte(cmd, 0x00, true);
-	//i2c_master_write_byte(cmd, OLED_CONTROL_BYTE_DATA_STREAM, true);	// 40
-	i2c_master_write_byte(cmd, OLED_CMD_SET_DISPLAY_START_LINE, true);	// 40
-	//i2c_master_write_byte(cmd, OLED_CMD_SET_SEGMENT_REMAP, true);		// A1
+	uint8_t out_buf[27];
+	int out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM;
+	out_buf[out_index++] = OLED_CMD_DISPLAY_OFF;				// AE
+	out_buf[out_index++] = OLED_CMD_SET_MUX_RATIO;			 // A8
+	if (dev->_height == 64) out_buf[out_index++] = 0x3F;
+	if (dev->_height == 32) out_buf[out_index++] = 0x1F;
+	out_buf[out_index++] = OLED_CMD_SET_DISPLAY_OFFSET;		 // D3
+	out_buf[out_index++] = 0x00;
+	//out_buf[out_index++] = OLED_CONTROL_BYTE_DATA_STREAM;	// 40
+	out_buf[out_index++] = OLED_CMD_SET_DISPLAY_START_LINE;	// 40
+	//out_buf[out_index++] = OLED_CMD_SET_SEGMENT_REMAP;		// A1
 	if (dev->_flip) {
-		i2c_master_write_byte(cmd, OLED_CMD_SET_SEGMENT_REMAP_0, true); // A0
+		out_buf[out_index++] = OLED_CMD_SET_SEGMENT_REMAP_0; // A0
 	} else {
-		i2c_master_write_byte(cmd, OLED_CMD_SET_SEGMENT_REMAP_1, true);	// A1
+		out_buf[out_index++] = OLED_CMD_SET_SEGMENT_REMAP_1;	// A1
 	}
-	i2c_master_write_byte(cmd, OLED_CMD_SET_COM_SCAN_MODE, true);		// C8
-	i2c_master_write_byte(cmd, OLED_CMD_SET_DISPLAY_CLK_DIV, true);		// D5
-	i2c_master_write_byte(cmd, 0x80, true);
-	i2c_master_write_byte(cmd, OLED_CMD_SET_COM_PIN_MAP, true);			// DA
-	if (dev->_height == 64) i2c_master_write_byte(cmd, 0x12, true);
-	if (dev->_height == 32) i2c_master_write_byte(cmd, 0x02, true);
-	i2c_master_write_byte(cmd, OLED_CMD_SET_CONTRAST, true);			// 81
-	i2c_master_write_byte(cmd, 0xFF, true);
-	i2c_master_write_byte(cmd, OLED_CMD_DISPLAY_RAM, true);				// A4
-	i2c_master_write_byte(cmd, OLED_CMD_SET_VCOMH_DESELCT, true);		// DB
-	i2c_master_write_byte(cmd, 0x40, true);
-	i2c_master_write_byte(cmd, OLED_CMD_SET_MEMORY_ADDR_MODE, true);	// 20
-	//i2c_master_write_byte(cmd, OLED_CMD_SET_HORI_ADDR_MODE, true);	// 00
-	i2c_master_write_byte(cmd, OLED_CMD_SET_PAGE_ADDR_MODE, true);		// 02
+	out_buf[out_index++] = OLED_CMD_SET_COM_SCAN_MODE;		// C8
+	out_buf[out_index++] = OLED_CMD_SET_DISPLAY_CLK_DIV;		// D5
+	out_buf[out_index++] = 0x80;
+	out_buf[out_index++] = OLED_CMD_SET_COM_PIN_MAP;			// DA
+	if (dev->_height == 64) out_buf[out_index++] = 0x12;
+	if (dev->_height == 32) out_buf[out_index++] = 0x02;
+	out_buf[out_index++] = OLED_CMD_SET_CONTRAST;			// 81
+	out_buf[out_index++] = 0xFF;
+	out_buf[out_index++] = OLED_CMD_DISPLAY_RAM;				// A4
+	out_buf[out_index++] = OLED_CMD_SET_VCOMH_DESELCT;		// DB
+	out_buf[out_index++] = 0x40;
+	out_buf[out_index++] = OLED_CMD_SET_MEMORY_ADDR_MODE;	// 20
+	//out_buf[out_index++] = OLED_CMD_SET_HORI_ADDR_MODE;	// 00
+	out_buf[out_index++] = OLED_CMD_SET_PAGE_ADDR_MODE;		// 02
 	// Set Lower Column Start Address for Page Addressing Mode
-	i2c_master_write_byte(cmd, 0x00, true);
+	out_buf[out_index++] = 0x00;
 	// Set Higher Column Start Address for Page Addressing Mode
-	i2c_master_write_byte(cmd, 0x10, true);
-	i2c_master_write_byte(cmd, OLED_CMD_SET_CHARGE_PUMP, true);			// 8D
-	i2c_master_write_byte(cmd, 0x14, true);
-	i2c_master_write_byte(cmd, OLED_CMD_DEACTIVE_SCROLL, true);			// 2E
-	i2c_master_write_byte(cmd, OLED_CMD_DISPLAY_NORMAL, true);			// A6
-	i2c_master_write_byte(cmd, OLED_CMD_DISPLAY_ON, true);				// AF
-
-	i2c_master_stop(cmd);
-
-	esp_err_t res = i2c_master_cmd_begin(dev->_i2c_num, cmd, I2C_TICKS_TO_WAIT);
+	out_buf[out_index++] = 0x10;
+	out_buf[out_index++] = OLED_CMD_SET_CHARGE_PUMP;			// 8D
+	out_buf[out_index++] = 0x14;
+	out_buf[out_index++] = OLED_CMD_DEACTIVE_SCROLL;			// 2E
+	out_buf[out_index++] = OLED_CMD_DISPLAY_NORMAL;			// A6
+	out_buf[out_index++] = OLED_CMD_DISPLAY_ON;				// AF
+
+	esp_err_t res;
+	res = i2c_write_stream(dev, out_buf, out_index);
 	if (res == ESP_OK) {
 		ESP_LOGI(TAG, "OLED configured successfully");
 	} else {
 		ESP_LOGE(TAG, "OLED configuration failed. code: 0x%.2X", res);
 	}
-	i2c_cmd_link_delete(cmd);
 }
 
 
 void i2c_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width) {
 	if (page >= dev->_pages) return;
 	if (seg >= dev->_width) return;
+	if (width > dev->_width - seg) width = dev->_width - seg;
 
 	int _seg = seg + CONFIG_OFFSETX;
 	uint8_t columLow = _seg & 0x0F;
@@ -154,137 +176,218 @@ void i2c_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * image
 		_page = (dev->_pages - page) - 1;
 	}
 
-	i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-	i2c_master_start(cmd);
-	i2c_master_write_byte(cmd, (dev->_address << 1) | I2C_MASTER_WRITE, true);
-
-	i2c_master_write_byte(cmd, OLED_CONTROL_BYTE_CMD_STREAM, true);
+	uint8_t out_buf[3];
 	// Set Lower Column Start Address for Page Addressing Mode
-	i2c_master_write_byte(cmd, (0x00 + columLow), true);
+	out_buf[0] = (0x00 + columLow);
 	// Set Higher Column Start Address for Page Addressing Mode
-	i2c_master_write_byte(cmd, (0x10 + columHigh), true);
+	out_buf[1] = (0x10 + columHigh);
 	// Set Page Start Address for Page Addressing Mode
-	i2c_master_write_byte(cmd, 0xB0 | _page, true);
+	out_buf[2] = 0xB0 | _page;
 
-	i2c_master_stop(cmd);
-	esp_err_t res = i2c_master_cmd_begin(dev->_i2c_num, cmd, I2C_TICKS_TO_WAIT);
+	esp_err_t res = i2c_write_control(dev, OLED_CONTROL_BYTE_CMD_STREAM, out_buf, sizeof(out_buf));
 	if (res != ESP_OK) {
 		ESP_LOGE(TAG, "Image command failed. code: 0x%.2X", res);
 	}
-	i2c_cmd_link_delete(cmd);
 
-	cmd = i2c_cmd_link_create();
+	// The image is written straight from the caller's buffer
+	res = i2c_write_control(dev, OLED_CONTROL_BYTE_DATA_STREAM, images, width);
+	if (res != ESP_OK) {
+		ESP_LOGE(TAG, "Image command failed. code: 0x%.2X", res);
+	}
+	dev->_txBytes += 4 + width + 1;
+}
+
+// Stream a rectangle of the internal buffer in horizontal addressing mode.
+// The column/page window is set once and the panel wraps pages by itself,
+// so every page of the rectangle goes out in a single data transfer.
+void i2c_display_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end) {
+	int width = seg_end - seg_start + 1;
+	int pages = page_end - page_start + 1;
+
+	// With flip the logical pages are stored bottom-up in the panel
+	int _page_start = page_start;
+	int _page_end = page_end;
+	if (dev->_flip) {
+		_page_start = (dev->_pages - page_end) - 1;
+		_page_end = (dev->_pages - page_start) - 1;
+	}
+
+	uint8_t out_buf[9];
+	int out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM;
+	out_buf[out_index++] = OLED_CMD_SET_MEMORY_ADDR_MODE;	// 20
+	out_buf[out_index++] = OLED_CMD_SET_HORI_ADDR_MODE;		// 00
+	out_buf[out_index++] = OLED_CMD_SET_COLUMN_RANGE;		// 21
+	out_buf[out_index++] = seg_start + CONFIG_OFFSETX;
+	out_buf[out_index++] = seg_end + CONFIG_OFFSETX;
+	out_buf[out_index++] = OLED_CMD_SET_PAGE_RANGE;			// 22
+	out_buf[out_index++] = _page_start;
+	out_buf[out_index++] = _page_end;
+
+	esp_err_t res = i2c_write_stream(dev, out_buf, out_index);
+	if (res != ESP_OK) {
+		ESP_LOGE(TAG, "Window command failed. code: 0x%.2X", res);
+	}
+
+	// Control byte plus one slice per page, straight from the page buffers
+	uint8_t link_buf[I2C_LINK_RECOMMENDED_SIZE(3)] = { 0 };
+	i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(link_buf, sizeof(link_buf));
 	i2c_master_start(cmd);
 	i2c_master_write_byte(cmd, (dev->_address << 1) | I2C_MASTER_WRITE, true);
 	i2c_master_write_byte(cmd, OLED_CONTROL_BYTE_DATA_STREAM, true);
-	i2c_master_write(cmd, images, width, true);
+	for (int i = 0; i < pages; i++) {
+		int page = dev->_flip ? page_end - i : page_start + i;
+		i2c_master_write(cmd, &dev->_page[page]._segs[seg_start], width, true);
+	}
 	i2c_master_stop(cmd);
-
 	res = i2c_master_cmd_begin(dev->_i2c_num, cmd, I2C_TICKS_TO_WAIT);
 	if (res != ESP_OK) {
-		ESP_LOGE(TAG, "Image command failed. code: 0x%.2X", res);
+		ESP_LOGE(TAG, "Window data failed. code: 0x%.2X", res);
 	}
-	i2c_cmd_link_delete(cmd);
+	i2c_cmd_link_delete_static(cmd);
+
+	// Back to page addressing mode for the page-based paths
+	out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM;
+	out_buf[out_index++] = OLED_CMD_SET_MEMORY_ADDR_MODE;	// 20
+	out_buf[out_index++] = OLED_CMD_SET_PAGE_ADDR_MODE;		// 02
+	res = i2c_write_stream(dev, out_buf, out_index);
+	if (res != ESP_OK) {
+		ESP_LOGE(TAG, "Window command failed. code: 0x%.2X", res);
+	}
+
+	dev->_txBytes += 9 + 1 + pages * width + 3;
+}
+
+// Change the SCL clock of the port (period in APB clock cycles, 50 % duty)
+void i2c_bus_speed(SSD1306_t * dev, uint32_t speed_hz) {
+	int period = APB_CLK_FREQ / speed_hz;
+	ESP_ERROR_CHECK(i2c_set_period(dev->_i2c_num, period / 2, period / 2));
+	ESP_LOGI(TAG, "I2C clock speed=%"PRIu32" kHz", speed_hz / 1000);
 }
 
 void i2c_contrast(SSD1306_t * dev, int contrast) {
-	int _contrast = contrast;
+	uint8_t _contrast = contrast;
 	if (contrast < 0x0) _contrast = 0;
 	if (contrast > 0xFF) _contrast = 0xFF;
 
-	i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-	i2c_master_start(cmd);
-	i2c_master_write_byte(cmd, (dev->_address << 1) | I2C_MASTER_WRITE, true);
-	i2c_master_write_byte(cmd, OLED_CONTROL_BYTE_CMD_STREAM, true); // 00
-	i2c_master_write_byte(cmd, OLED_CMD_SET_CONTRAST, true); // 81
-	i2c_master_write_byte(cmd, _contrast, true);
-	i2c_master_stop(cmd);
+	uint8_t out_buf[3];
+	int out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM; // 00
+	out_buf[out_index++] = OLED_CMD_SET_CONTRAST; // 81
+	out_buf[out_index++] = _contrast;
 
-	esp_err_t res = i2c_master_cmd_begin(dev->_i2c_num, cmd, I2C_TICKS_TO_WAIT);
-	if (res != ESP_OK) {
+	esp_err_t res = i2c_write_stream(dev, out_buf, 3);
+	if (res != ESP_OK)
 		ESP_LOGE(TAG, "Contrast command failed. code: 0x%.2X", res);
-	}
-	i2c_cmd_link_delete(cmd);
 }
 
 
 void i2c_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll) {
-	i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-	i2c_master_start(cmd);
-
-	i2c_master_write_byte(cmd, (dev->_address << 1) | I2C_MASTER_WRITE, true);
-	i2c_master_write_byte(cmd, OLED_CONTROL_BYTE_CMD_STREAM, true); // 00
+	uint8_t out_buf[11];
+	int out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM; // 00
 
 	if (scroll == SCROLL_RIGHT) {
-		i2c_master_write_byte(cmd, OLED_CMD_HORIZONTAL_RIGHT, true); // 26
-		i2c_master_write_byte(cmd, 0x00, true); // Dummy byte
-		i2c_master_write_byte(cmd, 0x00, true); // Define start page address
-		i2c_master_write_byte(cmd, 0x07, true); // Frame frequency
-		i2c_master_write_byte(cmd, 0x07, true); // Define end page address
-		i2c_master_write_byte(cmd, 0x00, true); //
-		i2c_master_write_byte(cmd, 0xFF, true); //
-		i2c_master_write_byte(cmd, OLED_CMD_ACTIVE_SCROLL, true); // 2F
+		out_buf[out_index++] = OLED_CMD_HORIZONTAL_RIGHT; // 26
+		out_buf[out_index++] = 0x00; // Dummy byte
+		out_buf[out_index++] = 0x00; // Define start page address
+		out_buf[out_index++] = 0x07; // Frame frequency
+		out_buf[out_index++] = 0x07; // Define end page address
+		out_buf[out_index++] = 0x00; //
+		out_buf[out_index++] = 0xFF; //
+		out_buf[out_index++] = OLED_CMD_ACTIVE_SCROLL; // 2F
 	} 
 
 	if (scroll == SCROLL_LEFT) {
-		i2c_master_write_byte(cmd, OLED_CMD_HORIZONTAL_LEFT, true); // 27
-		i2c_master_write_byte(cmd, 0x00, true); // Dummy byte
-		i2c_master_write_byte(cmd, 0x00, true); // Define start page address
-		i2c_master_write_byte(cmd, 0x07, true); // Frame frequency
-		i2c_master_write_byte(cmd, 0x07, true); // Define end page address
-		i2c_master_write_byte(cmd, 0x00, true); //
-		i2c_master_write_byte(cmd, 0xFF, true); //
-		i2c_master_write_byte(cmd, OLED_CMD_ACTIVE_SCROLL, true); // 2F
+		out_buf[out_index++] = OLED_CMD_HORIZONTAL_LEFT; // 27
+		out_buf[out_index++] = 0x00; // Dummy byte
+		out_buf[out_index++] = 0x00; // Define start page address
+		out_buf[out_index++] = 0x07; // Frame frequency
+		out_buf[out_index++] = 0x07; // Define end page address
+		out_buf[out_index++] = 0x00; //
+		out_buf[out_index++] = 0xFF; //
+		out_buf[out_index++] = OLED_CMD_ACTIVE_SCROLL; // 2F
 	} 
 
 	if (scroll == SCROLL_DOWN) {
-		i2c_master_write_byte(cmd, OLED_CMD_CONTINUOUS_SCROLL, true); // 29
-		i2c_master_write_byte(cmd, 0x00, true); // Dummy byte
-		i2c_master_write_byte(cmd, 0x00, true); // Define start page address
-		i2c_master_write_byte(cmd, 0x07, true); // Frame frequency
-		//i2c_master_write_byte(cmd, 0x01, true); // Define end page address
-		i2c_master_write_byte(cmd, 0x00, true); // Define end page address
-		i2c_master_write_byte(cmd, 0x3F, true); // Vertical scrolling offset
-
-		i2c_master_write_byte(cmd, OLED_CMD_VERTICAL, true); // A3
-		i2c_master_write_byte(cmd, 0x00, true);
+		out_buf[out_index++] = OLED_CMD_CONTINUOUS_SCROLL; // 29
+		out_buf[out_index++] = 0x00; // Dummy byte
+		out_buf[out_index++] = 0x00; // Define start page address
+		out_buf[out_index++] = 0x07; // Frame frequency
+		//out_buf[out_index++] = 0x01; // Define end page address
+		out_buf[out_index++] = 0x00; // Define end page address
+		out_buf[out_index++] = 0x3F; // Vertical scrolling offset
+
+		out_buf[out_index++] = OLED_CMD_VERTICAL; // A3
+		out_buf[out_index++] = 0x00;
 		if (dev->_height == 64)
-		//i2c_master_write_byte(cmd, 0x7F, true);
-		i2c_master_write_byte(cmd, 0x40, true);
+		//out_buf[out_index++] = 0x7F;
+		out_buf[out_index++] = 0x40;
 		if (dev->_height == 32)
-		i2c_master_write_byte(cmd, 0x20, true);
-		i2c_master_write_byte(cmd, OLED_CMD_ACTIVE_SCROLL, true); // 2F
+		out_buf[out_index++] = 0x20;
+		out_buf[out_index++] = OLED_CMD_ACTIVE_SCROLL; // 2F
 	}
 
 	if (scroll == SCROLL_UP) {
-		i2c_master_write_byte(cmd, OLED_CMD_CONTINUOUS_SCROLL, true); // 29
-		i2c_master_write_byte(cmd, 0x00, true); // Dummy byte
-		i2c_master_write_byte(cmd, 0x00, true); // Define start page address
-		i2c_master_write_byte(cmd, 0x07, true); // Frame frequency
-		//i2c_master_write_byte(cmd, 0x01, true); // Define end page address
-		i2c_master_write_byte(cmd, 0x00, true); // Define end page address
-		i2c_master_write_byte(cmd, 0x01, true); // Vertical scrolling offset
-
-		i2c_master_write_byte(cmd, OLED_CMD_VERTICAL, true); // A3
-		i2c_master_write_byte(cmd, 0x00, true);
+		out_buf[out_index++] = OLED_CMD_CONTINUOUS_SCROLL; // 29
+		out_buf[out_index++] = 0x00; // Dummy byte
+		out_buf[out_index++] = 0x00; // Define start page address
+		out_buf[out_index++] = 0x07; // Frame frequency
+		//out_buf[out_index++] = 0x01; // Define end page address
+		out_buf[out_index++] = 0x00; // Define end page address
+		out_buf[out_index++] = 0x01; // Vertical scrolling offset
+
+		out_buf[out_index++] = OLED_CMD_VERTICAL; // A3
+		out_buf[out_index++] = 0x00;
 		if (dev->_height == 64)
-		//i2c_master_write_byte(cmd, 0x7F, true);
-		i2c_master_write_byte(cmd, 0x40, true);
+		//out_buf[out_index++] = 0x7F;
+		out_buf[out_index++] = 0x40;
 		if (dev->_height == 32)
-		i2c_master_write_byte(cmd, 0x20, true);
-		i2c_master_write_byte(cmd, OLED_CMD_ACTIVE_SCROLL, true); // 2F
+		out_buf[out_index++] = 0x20;
+		out_buf[out_index++] = OLED_CMD_ACTIVE_SCROLL; // 2F
 	}
 
 	if (scroll == SCROLL_STOP) {
-		i2c_master_write_byte(cmd, OLED_CMD_DEACTIVE_SCROLL, true); // 2E
+		out_buf[out_index++] = OLED_CMD_DEACTIVE_SCROLL; // 2E
 	}
 
-	i2c_master_stop(cmd);
-
-	esp_err_t res = i2c_master_cmd_begin(dev->_i2c_num, cmd, I2C_TICKS_TO_WAIT);
-	if (res != ESP_OK) {
+	esp_err_t res = i2c_write_stream(dev, out_buf, out_index);
+	if (res != ESP_OK)
 		ESP_LOGE(TAG, "Scroll command failed. code: 0x%.2X", res);
+}
+
+// Shift a rectangle of GDDRAM one column left (content scroll). Unlike the
+// continuous scroll the RAM itself moves, so drawing can go on afterwards.
+// The panel needs two frames between consecutive content scroll commands.
+void i2c_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end) {
+	// The window is in GDDRAM columns, as the write paths store them: flip
+	// mirrors only the pages. Init always sends C8 and flip only swaps A1 for
+	// A0, and 2Ch/2Dh are defined on the displayed picture, so the command
+	// that moves GDDRAM towards seg_start follows the segment remap alone
+	int _page_start = page_start;
+	int _page_end = page_end;
+	if (dev->_flip) {
+		_page_start = (dev->_pages - page_end) - 1;
+		_page_end = (dev->_pages - page_start) - 1;
 	}
-	i2c_cmd_link_delete(cmd);
+	uint8_t command = dev->_flip ? OLED_CMD_CONTENT_SCROLL_RIGHT : OLED_CMD_CONTENT_SCROLL_LEFT; // A0 : A1
+
+	uint8_t out_buf[9];
+	int out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM; // 00
+	out_buf[out_index++] = command; // 2D (2C with A0 remap)
+	out_buf[out_index++] = 0x00; // Dummy byte
+	out_buf[out_index++] = _page_start; // Define start page address
+	out_buf[out_index++] = 0x01; // Dummy byte
+	out_buf[out_index++] = _page_end; // Define end page address
+	out_buf[out_index++] = 0x00; // Dummy byte
+	out_buf[out_index++] = seg_start + CONFIG_OFFSETX; // Define start column address
+	out_buf[out_index++] = seg_end + CONFIG_OFFSETX; // Define end column address
+
+	esp_err_t res = i2c_write_stream(dev, out_buf, out_index);
+	if (res != ESP_OK)
+		ESP_LOGE(TAG, "Scroll command failed. code: 0x%.2X", res);
+	dev->_txBytes += out_index;
 }
 
@@ -1,4 +1,5 @@
 #include <string.h>
+#include <inttypes.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -159,6 +160,7 @@ void i2c_init(SSD1306_t * dev, int width, int height) {
 void i2c_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width) {
 	if (page >= dev->_pages) return;
 	if (seg >= dev->_width) return;
+	if (width > dev->_width - seg) width = dev->_width - seg;
 
 	int _seg = seg + CONFIG_OFFSETX;
 	uint8_t columLow = _seg & 0x0F;
@@ -169,12 +171,7 @@ void i2c_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * image
 		_page = (dev->_pages - page) - 1;
 	}
 
-	uint8_t *out_buf;
-	out_buf = malloc(width < 4 ? 4 : width + 1);
-	if (out_buf == NULL) {
-		ESP_LOGE(TAG, "malloc fail");
-		return;
-	}
+	uint8_t out_buf[4];
 	int out_index = 0;
 	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM;
 	// Set Lower Column Start Address for Page Addressing Mode
@@ -189,13 +186,96 @@ void i2c_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * image
 	if (res != ESP_OK)
 		ESP_LOGE(TAG, "Could not write to device [0x%02x at %d]: %d (%s)", dev->_address, dev->_i2c_num, res, esp_err_to_name(res));
 
-	out_buf[0] = OLED_CONTROL_BYTE_DATA_STREAM;
-	memcpy(&out_buf[1], images, width);
+	// Data goes through the buffer preallocated in SSD1306_t (no malloc per glyph)
+	dev->_txBuf[0] = OLED_CONTROL_BYTE_DATA_STREAM;
+	memcpy(&dev->_txBuf[1], images, width);
+
+	res = i2c_master_transmit(dev->_i2c_dev_handle, dev->_txBuf, width + 1, I2C_TICKS_TO_WAIT);
+	if (res != ESP_OK)
+		ESP_LOGE(TAG, "Could not write to device [0x%02x at %d]: %d (%s)", dev->_address, dev->_i2c_num, res, esp_err_to_name(res));
+	dev->_txBytes += out_index + width + 1;
+}
+
+// Stream a rectangle of the internal buffer in horizontal addressing mode.
+// The column/page window is set once and the panel wraps pages by itself,
+// so every page of the rectangle goes out in a single data transfer.
+void i2c_display_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end) {
+	int width = seg_end - seg_start + 1;
+	int pages = page_end - page_start + 1;
+
+	// With flip the logical pages are stored bottom-up in the panel
+	int _page_start = page_start;
+	int _page_end = page_end;
+	if (dev->_flip) {
+		_page_start = (dev->_pages - page_end) - 1;
+		_page_end = (dev->_pages - page_start) - 1;
+	}
+
+	uint8_t out_buf[9];
+	int out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM;
+	out_buf[out_index++] = OLED_CMD_SET_MEMORY_ADDR_MODE;	// 20
+	out_buf[out_index++] = OLED_CMD_SET_HORI_ADDR_MODE;		// 00
+	out_buf[out_index++] = OLED_CMD_SET_COLUMN_RANGE;		// 21
+	out_buf[out_index++] = seg_start + CONFIG_OFFSETX;
+	out_buf[out_index++] = seg_end + CONFIG_OFFSETX;
+	out_buf[out_index++] = OLED_CMD_SET_PAGE_RANGE;			// 22
+	out_buf[out_index++] = _page_start;
+	out_buf[out_index++] = _page_end;
+
+	esp_err_t res;
+	res = i2c_master_transmit(dev->_i2c_dev_handle, out_buf, out_index, I2C_TICKS_TO_WAIT);
+	if (res != ESP_OK)
+		ESP_LOGE(TAG, "Could not write to device [0x%02x at %d]: %d (%s)", dev->_address, dev->_i2c_num, res, esp_err_to_name(res));
+
+#if (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0))
+	// Control byte plus one slice per page, straight from the page buffers
+	uint8_t control = OLED_CONTROL_BYTE_DATA_STREAM;
+	i2c_master_transmit_multi_buffer_info_t info[1 + 8];
+	info[0].write_buffer = &control;
+	info[0].buffer_size = 1;
+	for (int i = 0; i < pages; i++) {
+		int page = dev->_flip ? page_end - i : page_start + i;
+		info[1 + i].write_buffer = &dev->_page[page]._segs[seg_start];
+		info[1 + i].buffer_size = width;
+	}
+	res = i2c_master_multi_buffer_transmit(dev->_i2c_dev_handle, info, 1 + pages, I2C_TICKS_TO_WAIT);
+	if (res != ESP_OK)
+		ESP_LOGE(TAG, "Could not write to device [0x%02x at %d]: %d (%s)", dev->_address, dev->_i2c_num, res, esp_err_to_name(res));
+#else
+	// No multi-buffer transmit: one data transfer per page, the address still auto-increments
+	for (int i = 0; i < pages; i++) {
+		int page = dev->_flip ? page_end - i : page_start + i;
+		dev->_txBuf[0] = OLED_CONTROL_BYTE_DATA_STREAM;
+		memcpy(&dev->_txBuf[1], &dev->_page[page]._segs[seg_start], width);
+		res = i2c_master_transmit(dev->_i2c_dev_handle, dev->_txBuf, width + 1, I2C_TICKS_TO_WAIT);
+		if (res != ESP_OK)
+			ESP_LOGE(TAG, "Could not write to device [0x%02x at %d]: %d (%s)", dev->_address, dev->_i2c_num, res, esp_err_to_name(res));
+	}
+#endif
 
-	res = i2c_master_transmit(dev->_i2c_dev_handle, out_buf, width + 1, I2C_TICKS_TO_WAIT);
+	// Back to page addressing mode for the page-based paths
+	out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM;
+	out_buf[out_index++] = OLED_CMD_SET_MEMORY_ADDR_MODE;	// 20
+	out_buf[out_index++] = OLED_CMD_SET_PAGE_ADDR_MODE;		// 02
+	res = i2c_master_transmit(dev->_i2c_dev_handle, out_buf, out_index, I2C_TICKS_TO_WAIT);
 	if (res != ESP_OK)
 		ESP_LOGE(TAG, "Could not write to device [0x%02x at %d]: %d (%s)", dev->_address, dev->_i2c_num, res, esp_err_to_name(res));
-	free(out_buf);
+
+	dev->_txBytes += 9 + 1 + pages * width + 3;
+}
+
+// Change the SCL clock of this device; the new driver fixes it when the device is added
+void i2c_bus_speed(SSD1306_t * dev, uint32_t speed_hz) {
+	ESP_ERROR_CHECK(i2c_master_bus_rm_device(dev->_i2c_dev_handle));
+	i2c_device_config_t dev_cfg = {
+		.dev_addr_length = I2C_ADDR_BIT_LEN_7,
+		.device_address = dev->_address,
+		.scl_speed_hz = speed_hz,
+	};
+	ESP_ERROR_CHECK(i2c_master_bus_add_device(dev->_i2c_bus_handle, &dev_cfg, &dev->_i2c_dev_handle));
+	ESP_LOGI(TAG, "I2C clock speed=%"PRIu32" kHz", speed_hz / 1000);
 }
 
 void i2c_contrast(SSD1306_t * dev, int contrast) {
@@ -289,3 +369,37 @@ void i2c_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll) {
 		ESP_LOGE(TAG, "Could not write to device [0x%02x at %d]: %d (%s)", dev->_address, dev->_i2c_num, res, esp_err_to_name(res));
 }
 
+// Shift a rectangle of GDDRAM one column left (content scroll). Unlike the
+// continuous scroll the RAM itself moves, so drawing can go on afterwards.
+// The panel needs two frames between consecutive content scroll commands.
+void i2c_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end) {
+	// The window is in GDDRAM columns, as the write paths store them: flip
+	// mirrors only the pages. Init always sends C8 and flip only swaps A1 for
+	// A0, and 2Ch/2Dh are defined on the displayed picture, so the command
+	// that moves GDDRAM towards seg_start follows the segment remap alone
+	int _page_start = page_start;
+	int _page_end = page_end;
+	if (dev->_flip) {
+		_page_start = (dev->_pages - page_end) - 1;
+		_page_end = (dev->_pages - page_start) - 1;
+	}
+	uint8_t command = dev->_flip ? OLED_CMD_CONTENT_SCROLL_RIGHT : OLED_CMD_CONTENT_SCROLL_LEFT; // A0 : A1
+
+	uint8_t out_buf[9];
+	int out_index = 0;
+	out_buf[out_index++] = OLED_CONTROL_BYTE_CMD_STREAM; // 00
+	out_buf[out_index++] = command; // 2D (2C with A0 remap)
+	out_buf[out_index++] = 0x00; // Dummy byte
+	out_buf[out_index++] = _page_start; // Define start page address
+	out_buf[out_index++] = 0x01; // Dummy byte
+	out_buf[out_index++] = _page_end; // Define end page address
+	out_buf[out_index++] = 0x00; // Dummy byte
+	out_buf[out_index++] = seg_start + CONFIG_OFFSETX; // Define start column address
+	out_buf[out_index++] = seg_end + CONFIG_OFFSETX; // Define end column address
+
+	esp_err_t res = i2c_master_transmit(dev->_i2c_dev_handle, out_buf, out_index, I2C_TICKS_TO_WAIT);
+	if (res != ESP_OK)
+		ESP_LOGE(TAG, "Could not write to device [0x%02x at %d]: %d (%s)", dev->_address, dev->_i2c_num, res, esp_err_to_name(res));
+	dev->_txBytes += out_index;
+}
+
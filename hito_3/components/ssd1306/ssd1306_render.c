@@ -0,0 +1,91 @@
+#include <string.h>
+#include <inttypes.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+
+#include "ssd1306_render.h"
+
+#define TAG "SSD1306"
+
+#define RENDER_STACK_SIZE 3072
+
+// Copy the dirty spans of src into dst and mark them dirty there
+void ssd1306_render_move(SSD1306_t * dst, SSD1306_t * src)
+{
+	// Scrolls first: the dirty spans of src are already in scrolled positions
+	COLUMN_SCROLL_t scroll;
+	if (ssd1306_take_column_scroll(src, &scroll)) {
+		ssd1306_scroll_columns(dst, scroll._pageStart, scroll._pageEnd, scroll._segStart, scroll._segEnd, scroll._count);
+	}
+	for (int page=0; page<src->_pages; page++) {
+		int seg_start, seg_end;
+		if (!ssd1306_take_dirty(src, page, &seg_start, &seg_end)) continue;
+		memcpy(&dst->_page[page]._segs[seg_start], &src->_page[page]._segs[seg_start], seg_end - seg_start + 1);
+		ssd1306_mark_dirty(dst, page, seg_start, seg_end);
+	}
+}
+
+static void ssd1306_render_task(void * arg)
+{
+	ssd1306_render_t * render = arg;
+	TickType_t last = xTaskGetTickCount() - render->_period;
+
+	while (1) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		// Frame-rate cap; anything presented while waiting joins this frame
+		TickType_t elapsed = xTaskGetTickCount() - last;
+		if (elapsed < render->_period) vTaskDelay(render->_period - elapsed);
+
+		// Presents before this point are in the copy, later ones notify again
+		xSemaphoreTake(render->_lock, portMAX_DELAY);
+		ulTaskNotifyTake(pdTRUE, 0);
+		ssd1306_render_move(render->_dev, &render->_front);
+		xSemaphoreGive(render->_lock);
+
+		// The bus transfer runs without the lock, so present() never waits for it
+		ssd1306_show_buffer(render->_dev);
+		render->_frames++;
+		last = xTaskGetTickCount();
+		ESP_LOGD(TAG, "render frame %"PRIu32"/%"PRIu32", %"PRIu32" bytes",
+			render->_frames, render->_presents, ssd1306_get_flush_bytes(render->_dev));
+	}
+}
+
+esp_err_t ssd1306_render_start(ssd1306_render_t * render, SSD1306_t * dev, int max_fps, UBaseType_t priority)
+{
+	render->_dev = dev;
+	ssd1306_init_offscreen(&render->_back, dev);
+	ssd1306_init_offscreen(&render->_front, dev);
+	render->_period = (max_fps > 0) ? pdMS_TO_TICKS(1000 / max_fps) : 0;
+	render->_presents = 0;
+	render->_frames = 0;
+
+	render->_lock = xSemaphoreCreateMutex();
+	if (render->_lock == NULL) return ESP_ERR_NO_MEM;
+	if (xTaskCreate(ssd1306_render_task, "ssd1306_render", RENDER_STACK_SIZE, render, priority, &render->_task) != pdPASS) {
+		vSemaphoreDelete(render->_lock);
+		return ESP_ERR_NO_MEM;
+	}
+	ESP_LOGI(TAG, "Render task started, max %d frames/s", max_fps);
+	return ESP_OK;
+}
+
+// Buffer the producer draws on. Only one task may draw on it.
+SSD1306_t * ssd1306_render_canvas(ssd1306_render_t * render)
+{
+	return &render->_back;
+}
+
+// Hand the frame drawn so far to the render task without waiting for the bus
+void ssd1306_render_present(ssd1306_render_t * render)
+{
+	xSemaphoreTake(render->_lock, portMAX_DELAY);
+	ssd1306_render_move(&render->_front, &render->_back);
+	render->_presents++;
+	xSemaphoreGive(render->_lock);
+	xTaskNotifyGive(render->_task);
+}
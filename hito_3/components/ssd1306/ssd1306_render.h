@@ -0,0 +1,41 @@
+#ifndef MAIN_SSD1306_RENDER_H_
+#define MAIN_SSD1306_RENDER_H_
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "ssd1306.h"
+
+// Double-buffered render service.
+// Producers draw on the back buffer (an offscreen device) and call
+// ssd1306_render_present(), which only copies the changed spans to the
+// front buffer. A low-priority task moves the front buffer to the panel
+// at most max_fps times per second. Frames presented in between are merged
+// into the next flush.
+typedef struct {
+	SSD1306_t * _dev; // Panel, only written by the render task
+	SSD1306_t _back; // Drawn by the producer
+	SSD1306_t _front; // Last presented frame, waiting for the task
+	SemaphoreHandle_t _lock; // Guards _front
+	TaskHandle_t _task;
+	TickType_t _period; // Minimum time between flushes
+	uint32_t _presents; // Frames presented
+	uint32_t _frames; // Frames sent to the panel (the difference was coalesced)
+} ssd1306_render_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+esp_err_t ssd1306_render_start(ssd1306_render_t * render, SSD1306_t * dev, int max_fps, UBaseType_t priority);
+SSD1306_t * ssd1306_render_canvas(ssd1306_render_t * render);
+void ssd1306_render_present(ssd1306_render_t * render);
+void ssd1306_render_move(SSD1306_t * dst, SSD1306_t * src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_RENDER_H_ */
@@ -1,10 +1,14 @@
 #include <string.h>
+#include <inttypes.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
 #include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 
 #include "ssd1306.h"
 
@@ -24,6 +28,88 @@
 
 int clock_speed_hz = SPI_DEFAULT_FREQUENCY;
 
+// Queued mode: a window goes out as three DMA transactions (setup commands,
+// all the pixel data, back to page mode) queued back to back. D/C is driven
+// from the pre-transfer callback, so the CPU does not wait between them.
+#define SPI_QUEUE_SIZE 4
+#define SPI_WINDOW_COMMANDS 8
+#define SPI_RESTORE_COMMANDS 2
+#define SPI_DC_VALID 0x100 // transaction user = SPI_DC_VALID | dc pin << 1 | level
+
+typedef struct spi_queue_t {
+	spi_transaction_t trans[SPI_QUEUE_SIZE];
+	int next;
+	int pending; // Queued, result not collected yet
+	bool enabled;
+	uint8_t * cmd; // DMA-capable: window setup + restore commands
+	uint8_t * frame; // DMA-capable copy of the window being sent
+} spi_queue_t;
+
+// Runs before each queued transaction (ISR context): set D/C for it
+static void IRAM_ATTR spi_pre_transfer_cb(spi_transaction_t * t)
+{
+	intptr_t dc = (intptr_t)t->user;
+	if (dc & SPI_DC_VALID) {
+		gpio_set_level((dc >> 1) & 0x7F, dc & 1);
+	}
+}
+
+static void spi_queue_create(SSD1306_t * dev)
+{
+	spi_queue_t * q = heap_caps_calloc(1, sizeof(spi_queue_t), MALLOC_CAP_DEFAULT);
+	if (q != NULL) {
+		q->cmd = heap_caps_malloc(SPI_WINDOW_COMMANDS + SPI_RESTORE_COMMANDS, MALLOC_CAP_DMA);
+		q->frame = heap_caps_malloc(8 * 128, MALLOC_CAP_DMA);
+	}
+	if (q == NULL || q->cmd == NULL || q->frame == NULL) {
+		ESP_LOGW(TAG, "No DMA memory for queued SPI; using polled transfers");
+		if (q != NULL) {
+			heap_caps_free(q->cmd);
+			heap_caps_free(q->frame);
+			heap_caps_free(q);
+		}
+		dev->_spiQueue = NULL;
+		return;
+	}
+#if CONFIG_SPI_QUEUED
+	q->enabled = true;
+#endif
+	dev->_spiQueue = q;
+}
+
+// Collect every queued transaction; buffers can be reused afterwards
+void spi_queue_wait(SSD1306_t * dev)
+{
+	spi_queue_t * q = dev->_spiQueue;
+	if (q == NULL) return;
+	while (q->pending > 0) {
+		spi_transaction_t * t;
+		spi_device_get_trans_result(dev->_spi_device_handle, &t, portMAX_DELAY);
+		q->pending--;
+	}
+}
+
+static void spi_queue_trans(SSD1306_t * dev, const uint8_t * data, size_t length, int level)
+{
+	spi_queue_t * q = dev->_spiQueue;
+	spi_transaction_t * t = &q->trans[q->next];
+	q->next = (q->next + 1) % SPI_QUEUE_SIZE;
+
+	memset(t, 0, sizeof(spi_transaction_t));
+	t->length = length * 8;
+	t->tx_buffer = data;
+	t->user = (void *)(intptr_t)(SPI_DC_VALID | (dev->_dc << 1) | level);
+	spi_device_queue_trans(dev->_spi_device_handle, t, portMAX_DELAY);
+	q->pending++;
+}
+
+void spi_queued_mode(SSD1306_t * dev, bool enable)
+{
+	if (dev->_spiQueue == NULL) return;
+	spi_queue_wait(dev);
+	dev->_spiQueue->enabled = enable;
+}
+
 void spi_clock_speed(int speed) {
 	ESP_LOGI(TAG, "SPI clock speed=%d MHz", speed/1000000);
 	clock_speed_hz = speed;
@@ -69,7 +155,8 @@ void spi_master_init(SSD1306_t * dev, int16_t mosi, int16_t sclk, int16_t cs, in
 	//devcfg.clock_speed_hz = SPI_DEFAULT_FREQUENCY;
 	devcfg.clock_speed_hz = clock_speed_hz;
 	devcfg.spics_io_num = cs;
-	devcfg.queue_size = 1;
+	devcfg.queue_size = SPI_QUEUE_SIZE;
+	devcfg.pre_cb = spi_pre_transfer_cb;
 
 	spi_device_handle_t spi_device_handle;
 	ret = spi_bus_add_device( HOST_ID, &devcfg, &spi_device_handle);
@@ -80,6 +167,7 @@ void spi_master_init(SSD1306_t * dev, int16_t mosi, int16_t sclk, int16_t cs, in
 	dev->_address = SPI_ADDRESS;
 	dev->_flip = false;
 	dev->_spi_device_handle = spi_device_handle;
+	spi_queue_create(dev);
 }
 
 void spi_device_add(SSD1306_t * dev, int16_t cs, int16_t dc, int16_t reset)
@@ -125,7 +213,8 @@ void spi_device_add(SSD1306_t * dev, int16_t cs, int16_t dc, int16_t reset)
 	//devcfg.clock_speed_hz = SPI_DEFAULT_FREQUENCY;
 	devcfg.clock_speed_hz = clock_speed_hz;
 	devcfg.spics_io_num = cs;
-	devcfg.queue_size = 1;
+	devcfg.queue_size = SPI_QUEUE_SIZE;
+	devcfg.pre_cb = spi_pre_transfer_cb;
 
 	spi_device_handle_t spi_device_handle;
 	ret = spi_bus_add_device( HOST_ID, &devcfg, &spi_device_handle);
@@ -136,6 +225,7 @@ void spi_device_add(SSD1306_t * dev, int16_t cs, int16_t dc, int16_t reset)
 	dev->_address = SPI_ADDRESS;
 	dev->_flip = false;
 	dev->_spi_device_handle = spi_device_handle;
+	spi_queue_create(dev);
 }
 
 
@@ -155,6 +245,7 @@ bool spi_master_write_byte(const spi_device_handle_t SPIHandle, const uint8_t* D
 
 bool spi_master_write_commands(SSD1306_t * dev, const uint8_t * Commands, size_t DataLength )
 {
+	spi_queue_wait(dev);
 	gpio_set_level( dev->_dc, SPI_COMMAND_MODE );
 	return spi_master_write_byte( dev->_spi_device_handle, Commands, DataLength );
 }
@@ -168,6 +259,7 @@ bool spi_master_write_command(SSD1306_t * dev, uint8_t Command )
 
 bool spi_master_write_data(SSD1306_t * dev, const uint8_t* Data, size_t DataLength )
 {
+	spi_queue_wait(dev);
 	gpio_set_level( dev->_dc, SPI_DATA_MODE );
 	return spi_master_write_byte( dev->_spi_device_handle, Data, DataLength );
 }
@@ -238,7 +330,70 @@ void spi_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * image
 	spi_master_write_commands(dev, commands, 3);
 
 	spi_master_write_data(dev, images, width);
+	dev->_txBytes += 3 + width;
+
+}
+
+// Stream a rectangle of the internal buffer in horizontal addressing mode.
+// D/C stays high for the whole rectangle and the panel wraps pages by itself.
+void spi_display_window(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end)
+{
+	int width = seg_end - seg_start + 1;
+	int pages = page_end - page_start + 1;
+
+	// With flip the logical pages are stored bottom-up in the panel
+	int _page_start = page_start;
+	int _page_end = page_end;
+	if (dev->_flip) {
+		_page_start = (dev->_pages - page_end) - 1;
+		_page_end = (dev->_pages - page_start) - 1;
+	}
+
+	spi_queue_t * q = dev->_spiQueue;
+	if (q != NULL && q->enabled) {
+		// The previous window may still be reading the DMA buffers
+		spi_queue_wait(dev);
+		uint8_t * cmd = q->cmd;
+		cmd[0] = OLED_CMD_SET_MEMORY_ADDR_MODE;
+		cmd[1] = OLED_CMD_SET_HORI_ADDR_MODE;
+		cmd[2] = OLED_CMD_SET_COLUMN_RANGE;
+		cmd[3] = seg_start + CONFIG_OFFSETX;
+		cmd[4] = seg_end + CONFIG_OFFSETX;
+		cmd[5] = OLED_CMD_SET_PAGE_RANGE;
+		cmd[6] = _page_start;
+		cmd[7] = _page_end;
+		cmd[8] = OLED_CMD_SET_MEMORY_ADDR_MODE;
+		cmd[9] = OLED_CMD_SET_PAGE_ADDR_MODE;
+		for (int i = 0; i < pages; i++) {
+			int page = dev->_flip ? page_end - i : page_start + i;
+			memcpy(&q->frame[i * width], &dev->_page[page]._segs[seg_start], width);
+		}
+		spi_queue_trans(dev, cmd, SPI_WINDOW_COMMANDS, SPI_COMMAND_MODE);
+		spi_queue_trans(dev, q->frame, pages * width, SPI_DATA_MODE);
+		spi_queue_trans(dev, &cmd[SPI_WINDOW_COMMANDS], SPI_RESTORE_COMMANDS, SPI_COMMAND_MODE);
+		dev->_txBytes += SPI_WINDOW_COMMANDS + pages * width + SPI_RESTORE_COMMANDS;
+		return;
+	}
+
+	uint8_t commands[8] = {
+		OLED_CMD_SET_MEMORY_ADDR_MODE, OLED_CMD_SET_HORI_ADDR_MODE,
+		OLED_CMD_SET_COLUMN_RANGE, seg_start + CONFIG_OFFSETX, seg_end + CONFIG_OFFSETX,
+		OLED_CMD_SET_PAGE_RANGE, _page_start, _page_end
+	};
+	spi_master_write_commands(dev, commands, sizeof(commands));
+
+	spi_queue_wait(dev);
+	gpio_set_level( dev->_dc, SPI_DATA_MODE );
+	for (int i = 0; i < pages; i++) {
+		int page = dev->_flip ? page_end - i : page_start + i;
+		spi_master_write_byte( dev->_spi_device_handle, &dev->_page[page]._segs[seg_start], width );
+	}
+
+	// Back to page addressing mode for the page-based paths
+	uint8_t restore[2] = { OLED_CMD_SET_MEMORY_ADDR_MODE, OLED_CMD_SET_PAGE_ADDR_MODE };
+	spi_master_write_commands(dev, restore, sizeof(restore));
 
+	dev->_txBytes += 8 + pages * width + 2;
 }
 
 void spi_contrast(SSD1306_t * dev, int contrast) {
@@ -315,3 +470,52 @@ void spi_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll)
 		spi_master_write_command(dev, OLED_CMD_DEACTIVE_SCROLL);	// 2E
 	}
 }
+
+// Shift a rectangle of GDDRAM one column left (content scroll)
+void spi_scroll_columns(SSD1306_t * dev, int page_start, int page_end, int seg_start, int seg_end)
+{
+	// The window is in GDDRAM columns, as the write paths store them: flip
+	// mirrors only the pages. Init always sends C8 and flip only swaps A1 for
+	// A0, and 2Ch/2Dh are defined on the displayed picture, so the command
+	// that moves GDDRAM towards seg_start follows the segment remap alone
+	int _page_start = page_start;
+	int _page_end = page_end;
+	if (dev->_flip) {
+		_page_start = (dev->_pages - page_end) - 1;
+		_page_end = (dev->_pages - page_start) - 1;
+	}
+	uint8_t command = dev->_flip ? OLED_CMD_CONTENT_SCROLL_RIGHT : OLED_CMD_CONTENT_SCROLL_LEFT; // A0 : A1
+
+	uint8_t commands[8] = {
+		command, 0x00, _page_start, 0x01, _page_end,
+		0x00, seg_start + CONFIG_OFFSETX, seg_end + CONFIG_OFFSETX
+	};
+	spi_master_write_commands(dev, commands, sizeof(commands));
+	dev->_txBytes += sizeof(commands);
+}
+
+// Full-frame throughput of the polled path against the queued DMA path.
+// "busy" is the time the caller is blocked per frame.
+void spi_benchmark(SSD1306_t * dev, int frames)
+{
+	if (dev->_spiQueue == NULL) return;
+	bool enabled = dev->_spiQueue->enabled;
+	const uint32_t frame_bytes = SPI_WINDOW_COMMANDS + dev->_pages * dev->_width + SPI_RESTORE_COMMANDS;
+
+	for (int queued = 0; queued <= 1; queued++) {
+		spi_queued_mode(dev, queued);
+		int64_t busy = 0;
+		int64_t start = esp_timer_get_time();
+		for (int i = 0; i < frames; i++) {
+			int64_t t0 = esp_timer_get_time();
+			ssd1306_show_frame(dev);
+			busy += esp_timer_get_time() - t0;
+		}
+		spi_queue_wait(dev);
+		int64_t elapsed = esp_timer_get_time() - start;
+		ESP_LOGI(TAG, "SPI %s: %"PRIu32" kB/s, %"PRId64" us/frame, busy %"PRId64" us/frame",
+			queued ? "queued DMA" : "polled",
+			(uint32_t)(frame_bytes * frames * 1000LL / elapsed), elapsed / frames, busy / frames);
+	}
+	spi_queued_mode(dev, enabled);
+}
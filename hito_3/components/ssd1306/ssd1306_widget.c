@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "ssd1306_widget.h"
+
+// Write rows [y, y+height) of column x from bits (bit 0 = row y).
+// Only the bytes that change are written and marked dirty.
+static bool widget_write_column(SSD1306_t * dev, int x, int y, int height, uint64_t bits)
+{
+	if (x < 0 || x >= dev->_width) return false;
+	uint64_t rows = (height >= 64) ? UINT64_MAX : ((1ULL << height) - 1);
+	uint64_t mask = rows << y;
+	uint64_t column = (bits & rows) << y;
+
+	bool changed = false;
+	for (int page = y / 8; page <= (y + height - 1) / 8 && page < dev->_pages; page++) {
+		uint8_t pmask = mask >> (page * 8);
+		uint8_t pbits = column >> (page * 8);
+		if (dev->_flip) {
+			pmask = ssd1306_rotate_byte(pmask);
+			pbits = ssd1306_rotate_byte(pbits);
+		}
+		uint8_t old = dev->_page[page]._segs[x];
+		uint8_t wk = (old & ~pmask) | pbits;
+		if (wk != old) {
+			dev->_page[page]._segs[x] = wk;
+			ssd1306_mark_dirty(dev, page, x, x);
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+// Rows from a to b inclusive, in either order
+static uint64_t widget_rows(int a, int b)
+{
+	if (a > b) {
+		int wk = a;
+		a = b;
+		b = wk;
+	}
+	uint64_t span = (b - a >= 63) ? UINT64_MAX : ((1ULL << (b - a + 1)) - 1);
+	return span << a;
+}
+
+// ---------------- Label ----------------
+
+void ssd1306_label_init(ssd1306_label_t * label, int page, int seg, int cols, bool invert)
+{
+	memset(label, 0, sizeof(ssd1306_label_t));
+	label->_page = page;
+	label->_seg = seg;
+	label->_cols = (cols > WIDGET_MAX_COLS) ? WIDGET_MAX_COLS : cols;
+	label->_invert = invert;
+}
+
+bool ssd1306_label_set(SSD1306_t * dev, ssd1306_label_t * label, const char * text)
+{
+	char padded[WIDGET_MAX_COLS + 1];
+	snprintf(padded, sizeof(padded), "%-*.*s", label->_cols, label->_cols, text);
+
+	// Redraw only the run between the first and last character that differ
+	int first = 0;
+	int last = label->_cols - 1;
+	if (label->_drawn) {
+		while (first < label->_cols && padded[first] == label->_text[first]) first++;
+		if (first == label->_cols) return false;
+		while (last > first && padded[last] == label->_text[last]) last--;
+	}
+
+	ssd1306_display_text_at(dev, label->_page, label->_seg + first * 8, &padded[first], last - first + 1, label->_invert);
+	memcpy(label->_text, padded, sizeof(padded));
+	label->_drawn = true;
+	return true;
+}
+
+// ---------------- Value ----------------
+
+void ssd1306_value_init(ssd1306_value_t * field, int page, int seg, int cols, const char * format)
+{
+	ssd1306_label_init(&field->_label, page, seg, cols, false);
+	field->_format = format;
+	field->_value = 0.0f;
+}
+
+bool ssd1306_value_set(SSD1306_t * dev, ssd1306_value_t * field, float value)
+{
+	if (field->_label._drawn && value == field->_value) return false;
+	field->_value = value;
+
+	char text[WIDGET_MAX_COLS + 1];
+	snprintf(text, sizeof(text), field->_format, value);
+	return ssd1306_label_set(dev, &field->_label, text);
+}
+
+// ---------------- Bar gauge ----------------
+
+void ssd1306_bar_init(ssd1306_bar_t * bar, int x, int y, int width, int height, int max)
+{
+	bar->_x = x;
+	bar->_y = y;
+	bar->_width = width;
+	bar->_height = height;
+	bar->_max = (max > 0) ? max : 1;
+	bar->_fill = -1;
+}
+
+bool ssd1306_bar_set(SSD1306_t * dev, ssd1306_bar_t * bar, int value)
+{
+	int inner = bar->_width - 2;
+	if (value < 0) value = 0;
+	if (value > bar->_max) value = bar->_max;
+	int fill = (value * inner + bar->_max / 2) / bar->_max;
+	if (fill == bar->_fill) return false;
+
+	uint64_t full = widget_rows(0, bar->_height - 1);
+	uint64_t frame = widget_rows(0, 0) | widget_rows(bar->_height - 1, bar->_height - 1);
+
+	// First draw: frame and every column. Later: only the columns between both fills.
+	int from = 0;
+	int to = inner;
+	if (bar->_fill < 0) {
+		widget_write_column(dev, bar->_x, bar->_y, bar->_height, full);
+		widget_write_column(dev, bar->_x + bar->_width - 1, bar->_y, bar->_height, full);
+	} else {
+		from = (fill < bar->_fill) ? fill : bar->_fill;
+		to = (fill < bar->_fill) ? bar->_fill : fill;
+	}
+	for (int i = from; i < to; i++) {
+		widget_write_column(dev, bar->_x + 1 + i, bar->_y, bar->_height, (i < fill) ? full : frame);
+	}
+	bar->_fill = fill;
+	return true;
+}
+
+// ---------------- Sparkline ----------------
+
+void ssd1306_sparkline_init(ssd1306_sparkline_t * spark, int x, int y, int width, int height, int min, int max)
+{
+	memset(spark, 0, sizeof(ssd1306_sparkline_t));
+	spark->_x = x;
+	spark->_y = y;
+	spark->_width = (width > 128) ? 128 : width;
+	spark->_height = height;
+	spark->_min = min;
+	spark->_max = (max > min) ? max : min + 1;
+}
+
+bool ssd1306_sparkline_push(SSD1306_t * dev, ssd1306_sparkline_t * spark, int value)
+{
+	if (value < spark->_min) value = spark->_min;
+	if (value > spark->_max) value = spark->_max;
+	// Row 0 is the top of the chart
+	int level = (spark->_max - value) * (spark->_height - 1) / (spark->_max - spark->_min);
+
+	spark->_levels[spark->_head] = level;
+	spark->_head = (spark->_head + 1) % spark->_width;
+	if (spark->_count < spark->_width) spark->_count++;
+
+	// Every sample moves one column left; unchanged bytes are not rewritten
+	bool changed = false;
+	int empty = spark->_width - spark->_count;
+	int index = (spark->_head + spark->_width - spark->_count) % spark->_width;
+	int prev = -1;
+	for (int col = 0; col < spark->_width; col++) {
+		uint64_t bits = 0;
+		if (col >= empty) {
+			int cur = spark->_levels[index];
+			bits = widget_rows((prev < 0) ? cur : prev, cur);
+			prev = cur;
+			index = (index + 1) % spark->_width;
+		}
+		changed |= widget_write_column(dev, spark->_x + col, spark->_y, spark->_height, bits);
+	}
+	return changed;
+}
+
+void ssd1306_scroll_chart_init(ssd1306_scroll_chart_t * chart, int x, int page, int pages, int width, int min, int max)
+{
+	memset(chart, 0, sizeof(ssd1306_scroll_chart_t));
+	chart->_x = x;
+	chart->_page = page;
+	chart->_pages = pages;
+	chart->_width = (width > 128) ? 128 : width;
+	chart->_min = min;
+	chart->_max = (max > min) ? max : min + 1;
+}
+
+// Draw every column from the ring, for the first sample or after the
+// buffer was cleared
+void ssd1306_scroll_chart_redraw(SSD1306_t * dev, ssd1306_scroll_chart_t * chart)
+{
+	int empty = chart->_width - chart->_count;
+	int index = (chart->_head + chart->_width - chart->_count) % chart->_width;
+	int prev = -1;
+	for (int col = 0; col < chart->_width; col++) {
+		uint64_t bits = 0;
+		if (col >= empty) {
+			int cur = chart->_levels[index];
+			bits = widget_rows((prev < 0) ? cur : prev, cur);
+			prev = cur;
+			index = (index + 1) % chart->_width;
+		}
+		widget_write_column(dev, chart->_x + col, chart->_page * 8, chart->_pages * 8, bits);
+	}
+	chart->_drawn = true;
+}
+
+bool ssd1306_scroll_chart_push(SSD1306_t * dev, ssd1306_scroll_chart_t * chart, int value)
+{
+	if (value < chart->_min) value = chart->_min;
+	if (value > chart->_max) value = chart->_max;
+	// Row 0 is the top of the chart
+	int height = chart->_pages * 8;
+	int level = (chart->_max - value) * (height - 1) / (chart->_max - chart->_min);
+	int prev = (chart->_count > 0) ? chart->_levels[(chart->_head + chart->_width - 1) % chart->_width] : level;
+
+	chart->_levels[chart->_head] = level;
+	chart->_head = (chart->_head + 1) % chart->_width;
+	if (chart->_count < chart->_width) chart->_count++;
+
+	if (!chart->_drawn) {
+		ssd1306_scroll_chart_redraw(dev, chart);
+		return true;
+	}
+
+	// Shift the history (on the panel itself only with CONFIG_CONTENT_SCROLL);
+	// only the newest column is drawn
+	int right = chart->_x + chart->_width - 1;
+	ssd1306_scroll_columns(dev, chart->_page, chart->_page + chart->_pages - 1, chart->_x, right, 1);
+	widget_write_column(dev, right, chart->_page * 8, height, widget_rows(prev, level));
+	return true;
+}
@@ -0,0 +1,97 @@
+#ifndef MAIN_SSD1306_WIDGET_H_
+#define MAIN_SSD1306_WIDGET_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ssd1306.h"
+
+// Retained-mode widgets on top of the SSD1306 page buffer.
+// Each widget remembers what it last drew and, when its value changes,
+// rewrites only the characters or columns that differ. Changed bytes are
+// marked dirty, so ssd1306_show_buffer() sends just those spans.
+// The *_set/_push functions return true when something was redrawn.
+
+#define WIDGET_MAX_COLS 16
+
+// Text field of fixed width in 8x8 characters, padded with blanks
+typedef struct {
+	int _page;
+	int _seg;
+	int _cols;
+	bool _invert;
+	bool _drawn;
+	char _text[WIDGET_MAX_COLS + 1]; // Last rendered text
+} ssd1306_label_t;
+
+// Label showing a number with a printf format (for example "R: %.1f Ohm")
+typedef struct {
+	ssd1306_label_t _label;
+	const char * _format;
+	float _value; // Last rendered value
+} ssd1306_value_t;
+
+// Horizontal bar gauge with a one pixel frame
+typedef struct {
+	int _x;
+	int _y;
+	int _width;
+	int _height; // 3 to 64 pixels, y + height <= 64
+	int _max;
+	int _fill; // Filled columns inside the frame, -1 before the first draw
+} ssd1306_bar_t;
+
+// Line chart of the last _width samples, newest on the right
+typedef struct {
+	int _x;
+	int _y;
+	int _width; // Up to 128 samples
+	int _height; // Up to 64 pixels, y + height <= 64
+	int _min;
+	int _max;
+	int _count; // Samples stored
+	int _head; // Next slot of the ring
+	uint8_t _levels[128]; // Ring of samples already scaled to rows
+} ssd1306_sparkline_t;
+
+// Line chart of the last _width samples, shifted one column left per sample.
+// With CONFIG_CONTENT_SCROLL the panel moves the history itself and only the
+// new column crosses the bus (_pages bytes). On a plain SSD1306 each row is
+// resent from the first column that changed: the new column while the
+// history is flat, up to _pages x _width bytes when it is busy
+// (see ssd1306_scroll_columns)
+typedef struct {
+	int _x;
+	int _page;
+	int _pages; // Height in pages of 8 pixels
+	int _width; // Up to 128 samples
+	int _min;
+	int _max;
+	int _count; // Samples stored
+	int _head; // Next slot of the ring
+	bool _drawn;
+	uint8_t _levels[128]; // Ring of samples already scaled to rows, for redraws
+} ssd1306_scroll_chart_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void ssd1306_label_init(ssd1306_label_t * label, int page, int seg, int cols, bool invert);
+bool ssd1306_label_set(SSD1306_t * dev, ssd1306_label_t * label, const char * text);
+void ssd1306_value_init(ssd1306_value_t * field, int page, int seg, int cols, const char * format);
+bool ssd1306_value_set(SSD1306_t * dev, ssd1306_value_t * field, float value);
+void ssd1306_bar_init(ssd1306_bar_t * bar, int x, int y, int width, int height, int max);
+bool ssd1306_bar_set(SSD1306_t * dev, ssd1306_bar_t * bar, int value);
+void ssd1306_sparkline_init(ssd1306_sparkline_t * spark, int x, int y, int width, int height, int min, int max);
+bool ssd1306_sparkline_push(SSD1306_t * dev, ssd1306_sparkline_t * spark, int value);
+void ssd1306_scroll_chart_init(ssd1306_scroll_chart_t * chart, int x, int page, int pages, int width, int min, int max);
+bool ssd1306_scroll_chart_push(SSD1306_t * dev, ssd1306_scroll_chart_t * chart, int value);
+void ssd1306_scroll_chart_redraw(SSD1306_t * dev, ssd1306_scroll_chart_t * chart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_WIDGET_H_ */
@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unity.h"
+
+#include "ssd1306.h"
+#include "ssd1306_font.h"
+#include "ssd1306_widget.h"
+
+#define PBM_PATH "ssd1306_host_test.pbm"
+#define TEXT "SSD1306"
+#define CHART_PAGE 5
+#define CHART_PAGES 3
+#define FLAT_PUSH_MAX_BYTES 32 // A few bytes per page, far below 3 x 128
+
+static SSD1306_t panel;
+
+// Framebuffer panel as the application would bring it up
+static void panel_init(SSD1306_t * dev, bool flip)
+{
+	memset(dev, 0, sizeof(SSD1306_t));
+	fb_master_init(dev);
+	dev->_flip = flip;
+	ssd1306_init(dev, 128, 64);
+}
+
+// Pixels where the framebuffer panel differs from the driver's buffer
+static int panel_mismatches(SSD1306_t * dev)
+{
+	int mismatches = 0;
+	for (int y=0;y<dev->_height;y++) {
+		for (int x=0;x<dev->_width;x++) {
+			bool lit = (dev->_page[y >> 3]._segs[x] >> (y & 7)) & 1;
+			if (fb_get_pixel(dev, x, y) != lit) mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+static void test_scroll_kernels_match_reference(void)
+{
+	TEST_ASSERT_EQUAL_INT(0, ssd1306_scroll_benchmark(&panel));
+}
+
+static void test_rotate_kernels_match_reference(void)
+{
+	TEST_ASSERT_EQUAL_INT(0, ssd1306_rotate_benchmark(&panel));
+}
+
+static void test_font_cache_matches_cold_render(void)
+{
+	TEST_ASSERT_EQUAL_INT(0, ssd1306_font_benchmark(&panel));
+}
+
+// The PBM holds exactly the pixels fb_get_pixel reports
+static void test_pbm_snapshot(void)
+{
+	ssd1306_clear_screen(&panel, false);
+	ssd1306_display_text(&panel, 2, TEXT, strlen(TEXT), false);
+	TEST_ASSERT_TRUE(fb_save_pbm(&panel, PBM_PATH));
+
+	FILE * fp = fopen(PBM_PATH, "rb");
+	TEST_ASSERT_NOT_NULL(fp);
+	int width = 0, height = 0;
+	TEST_ASSERT_EQUAL_INT(2, fscanf(fp, "P4 %d %d", &width, &height));
+	TEST_ASSERT_EQUAL_INT('\n', fgetc(fp));
+	TEST_ASSERT_EQUAL_INT(panel._width, width);
+	TEST_ASSERT_EQUAL_INT(panel._height, height);
+
+	uint8_t row[128 / 8];
+	int lit = 0, mismatches = 0;
+	for (int y=0;y<height;y++) {
+		TEST_ASSERT_EQUAL_INT(sizeof(row), fread(row, 1, sizeof(row), fp));
+		for (int x=0;x<width;x++) {
+			bool pixel = (row[x >> 3] >> (7 - (x & 7))) & 1;
+			if (pixel != fb_get_pixel(&panel, x, y)) mismatches++;
+			if (pixel) lit++;
+		}
+	}
+	fclose(fp);
+	remove(PBM_PATH);
+	TEST_ASSERT_EQUAL_INT(0, mismatches);
+	TEST_ASSERT_GREATER_THAN_INT(0, lit);
+}
+
+// A flipped module shows the same picture rotated 180 degrees
+static void test_flip_rotates_picture(void)
+{
+	static SSD1306_t flipped;
+	panel_init(&flipped, true);
+
+	ssd1306_clear_screen(&panel, false);
+	ssd1306_display_text(&panel, 2, TEXT, strlen(TEXT), false);
+	ssd1306_display_text(&flipped, 2, TEXT, strlen(TEXT), false);
+
+	int mismatches = 0;
+	for (int y=0;y<panel._height;y++) {
+		for (int x=0;x<panel._width;x++) {
+			if (fb_get_pixel(&flipped, x, y) != fb_get_pixel(&panel, panel._width - 1 - x, panel._height - 1 - y)) mismatches++;
+		}
+	}
+	TEST_ASSERT_EQUAL_INT(0, mismatches);
+}
+
+// Without the content scroll command the chart resends each row only from
+// the first column that changed, and the panel still matches the buffer
+static void test_scroll_chart_resends_changed_columns(void)
+{
+	static ssd1306_scroll_chart_t chart;
+	ssd1306_clear_screen(&panel, false);
+	ssd1306_scroll_chart_init(&chart, 0, CHART_PAGE, CHART_PAGES, panel._width, 0, 99);
+
+	for (int i=0;i<panel._width+8;i++) {
+		ssd1306_scroll_chart_push(&panel, &chart, 50);
+		ssd1306_show_buffer(&panel);
+	}
+	TEST_ASSERT_EQUAL_INT(0, panel_mismatches(&panel));
+	TEST_ASSERT_LESS_THAN_INT(FLAT_PUSH_MAX_BYTES, panel._flushBytes);
+
+	for (int i=0;i<panel._width;i++) {
+		ssd1306_scroll_chart_push(&panel, &chart, (i * 37) % 100);
+		ssd1306_show_buffer(&panel);
+		TEST_ASSERT_EQUAL_INT(0, panel_mismatches(&panel));
+	}
+}
+
+// The content scroll moves GDDRAM towards seg_start on both panels, so a
+// flipped module still shows the normal picture rotated 180 degrees
+static void test_content_scroll_follows_remap(void)
+{
+	static SSD1306_t flipped;
+	panel_init(&flipped, true);
+	ssd1306_clear_screen(&panel, false);
+	ssd1306_display_text(&panel, 2, TEXT, strlen(TEXT), false);
+	ssd1306_display_text(&flipped, 2, TEXT, strlen(TEXT), false);
+
+	fb_scroll_columns(&panel, 0, panel._pages - 1, 0, panel._width - 1);
+	fb_scroll_columns(&flipped, 0, flipped._pages - 1, 0, flipped._width - 1);
+
+	// The buffers were not shifted: the panel is one column ahead of them
+	int mismatches = 0;
+	for (int y=0;y<panel._height;y++) {
+		for (int x=0;x<panel._width-1;x++) {
+			bool lit = (panel._page[y >> 3]._segs[x + 1] >> (y & 7)) & 1;
+			if (fb_get_pixel(&panel, x, y) != lit) mismatches++;
+			if (fb_get_pixel(&flipped, panel._width - 1 - x, panel._height - 1 - y) != lit) mismatches++;
+		}
+	}
+	TEST_ASSERT_EQUAL_INT(0, mismatches);
+}
+
+void app_main(void)
+{
+	panel_init(&panel, false);
+
+	UNITY_BEGIN();
+	RUN_TEST(test_scroll_kernels_match_reference);
+	RUN_TEST(test_rotate_kernels_match_reference);
+	RUN_TEST(test_font_cache_matches_cold_render);
+	RUN_TEST(test_pbm_snapshot);
+	RUN_TEST(test_flip_rotates_picture);
+	RUN_TEST(test_scroll_chart_resends_changed_columns);
+	RUN_TEST(test_content_scroll_follows_remap);
+	exit(UNITY_END() == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+#define ADC_DECIM_CIC_ORDER 3
+#define ADC_DECIM_FIR_TAPS 21
+#define ADC_DECIM_FIR_FACTOR 2
+#define ADC_DECIM_FRAC_BITS 4  // Bits fraccionarios de la salida (12 bits + 4)
+
+// --- Decimador en punto fijo: CIC de orden 3 + FIR compensador /2 ---
+// El CIC baja la tasa por canal hasta CONFIG_ADC_DECIM_CIC_RATE_HZ; sus ceros
+// caen en todos los múltiplos de esa frecuencia, así que con 50 Hz anula la
+// red y su armónico de 100 Hz. El FIR corrige la caída del CIC en la banda de
+// paso, filtra el alias y decima por 2. El promediado aporta los bits extra.
+typedef struct {
+  uint64_t integ[ADC_DECIM_CIC_ORDER];  // Integradores (aritmética modular)
+  uint64_t comb[ADC_DECIM_CIC_ORDER];   // Retardo de cada etapa peine
+  uint64_t gain;                        // R^N
+  uint32_t ratio;                       // Factor de decimación del CIC (R)
+  uint32_t phase;                       // Muestras desde la última salida del CIC
+
+  // Historia del FIR duplicada para leer la ventana sin aritmética modular
+  uint16_t fir_hist[2 * ADC_DECIM_FIR_TAPS];
+  uint32_t fir_pos;
+  uint32_t fir_fill;
+  uint32_t fir_phase;
+
+  volatile uint16_t output;  // Última salida (Q12.ADC_DECIM_FRAC_BITS)
+  volatile bool ready;       // Historia del FIR completa
+} adc_decim_t;
+
+// Configura el decimador para una tasa de entrada por canal
+void adc_decim_init(adc_decim_t *decim, uint32_t input_rate_hz);
+
+// Filtra un bloque de muestras crudas de 12 bits. Devuelve cuántas salidas
+// nuevas ha producido.
+uint32_t adc_decim_process(adc_decim_t *decim, const uint16_t *samples, uint32_t count);
+
+// Frecuencia de salida en mHz para la tasa de entrada dada
+uint32_t adc_decim_output_rate_mhz(const adc_decim_t *decim, uint32_t input_rate_hz);
+
+#if CONFIG_ADC_DECIM_BENCHMARK
+void adc_decim_benchmark(uint32_t input_rate_hz);
+#endif
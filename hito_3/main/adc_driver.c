@@ -0,0 +1,672 @@
+#include "adc_driver.h"
+#include "adc_accum.h"
+#include "adc_calib.h"
+#include "adc_decim.h"
+#include "adc_ring.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "soc/soc_caps.h"
+#include <string.h>
+
+#define TAG "ADC_DRIVER"
+#define CONV_FRAME_SIZE 256
+#define FRAME_SAMPLES (CONV_FRAME_SIZE / SOC_ADC_DIGI_RESULT_BYTES)
+#define READ_TIMEOUT_MS 100
+#define NOTIFY_TIMEOUT_MS 1000  // Red de seguridad si se pierde alguna notificación
+#define ACQ_TASK_STACK 3072
+#define ACQ_TASK_PRIORITY 10
+#define MAX_HW_CHANNELS 16  // type1.channel ocupa 4 bits
+#define START_POLL_MS 10
+#define START_TIMEOUT_MARGIN_MS 500
+
+// 1: la tarea duerme hasta que on_conv_done/on_pool_ovf la notifican desde la ISR
+// 0: la tarea sondea adc_continuous_read con timeout
+#define ADC_DRIVER_EVENT_DRIVEN 1
+
+#if SOC_ADC_DIGI_RESULT_BYTES != 2
+#error "La decodificación por palabras asume resultados TYPE1 de 2 bytes (ESP32)"
+#endif
+
+// Patrón de conversión fijado en compilación a partir de Kconfig
+static const adc_channel_t adc_channels[] = {
+#if CONFIG_ADC_CH0
+  ADC_CHANNEL_0,
+#endif
+#if CONFIG_ADC_CH1
+  ADC_CHANNEL_1,
+#endif
+#if CONFIG_ADC_CH2
+  ADC_CHANNEL_2,
+#endif
+#if CONFIG_ADC_CH3
+  ADC_CHANNEL_3,
+#endif
+#if CONFIG_ADC_CH4
+  ADC_CHANNEL_4,
+#endif
+#if CONFIG_ADC_CH5
+  ADC_CHANNEL_5,
+#endif
+#if CONFIG_ADC_CH6
+  ADC_CHANNEL_6,
+#endif
+#if CONFIG_ADC_CH7
+  ADC_CHANNEL_7,
+#endif
+};
+
+#define NUM_CHANNELS (sizeof(adc_channels) / sizeof(adc_channels[0]))
+
+_Static_assert(NUM_CHANNELS > 0, "Habilita al menos un canal en ADC Configuration");
+_Static_assert(NUM_CHANNELS <= ADC_ACCUM_SLOTS, "Demasiados canales en el patrón");
+_Static_assert(FRAME_SAMPLES <= ADC_FRAME_SAMPLES, "Una trama no cabe en un push del buffer circular");
+
+static adc_continuous_handle_t s_handle = NULL;
+static TaskHandle_t s_acq_task = NULL;
+static adc_ring_t s_rings[NUM_CHANNELS];
+static adc_decim_t s_decim[NUM_CHANNELS];
+static int8_t s_channel_index[MAX_HW_CHANNELS];
+static volatile adc_driver_stats_t s_stats;
+static uint32_t s_sample_freq_hz = ADC_DRIVER_SAMPLE_FREQ_HZ;
+
+// Acumulado desde la última llamada a adc_driver_read_interval()
+static adc_accum_t s_interval;
+static portMUX_TYPE s_interval_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static bool IRAM_ATTR adc_on_pool_ovf(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data) {
+  s_stats.overflows++;
+#if ADC_DRIVER_EVENT_DRIVEN
+  // Despertar a la tarea para que vacíe el pool cuanto antes
+  BaseType_t must_yield = pdFALSE;
+  vTaskNotifyGiveFromISR(s_acq_task, &must_yield);
+  return must_yield == pdTRUE;
+#else
+  return false;
+#endif
+}
+
+#if ADC_DRIVER_EVENT_DRIVEN
+static bool IRAM_ATTR adc_on_conv_done(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data) {
+  BaseType_t must_yield = pdFALSE;
+  vTaskNotifyGiveFromISR(s_acq_task, &must_yield);
+  return must_yield == pdTRUE;
+}
+#endif
+
+// Estado de la decodificación de una trama: muestras separadas por canal
+// y acumuladores SoA de esa trama
+typedef struct {
+  uint16_t staged[NUM_CHANNELS][FRAME_SAMPLES];
+  uint32_t staged_count[NUM_CHANNELS];
+  adc_accum_t acc;
+  uint32_t dropped;
+} adc_frame_ctx_t;
+
+// Resultado TYPE1: bits 0-11 dato, bits 12-15 canal
+static inline void adc_decode_sample(adc_frame_ctx_t *ctx, uint32_t result) {
+  int idx = s_channel_index[(result >> 12) & 0xF];
+  if (idx < 0) {
+    ctx->dropped++;
+    return;
+  }
+  uint16_t data = result & 0xFFF;
+  ctx->staged[idx][ctx->staged_count[idx]++] = data;
+  adc_accum_add(&ctx->acc, idx, data);
+}
+
+// Decodifica una trama completa en una sola pasada leyendo palabras de 32 bits
+// alineadas (dos resultados por palabra) y la vuelca a los buffers por canal
+static void adc_process_frame(const uint8_t *frame, uint32_t len) {
+  static adc_frame_ctx_t ctx;
+
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    ctx.staged_count[c] = 0;
+    adc_accum_reset(&ctx.acc, c);
+  }
+  ctx.dropped = 0;
+
+  const uint32_t *words = (const uint32_t *)frame;
+  const uint32_t num_words = len / sizeof(uint32_t);
+  for (uint32_t w = 0; w < num_words; w++) {
+    uint32_t word = words[w];
+    adc_decode_sample(&ctx, word & 0xFFFF);
+    adc_decode_sample(&ctx, word >> 16);
+  }
+  if (len & 2) {
+    adc_decode_sample(&ctx, ((const uint16_t *)frame)[len / 2 - 1]);
+  }
+
+  uint32_t stored = 0;
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    if (ctx.staged_count[c] == 0) continue;
+    adc_ring_push(&s_rings[c], ctx.staged[c], ctx.staged_count[c]);
+    adc_decim_process(&s_decim[c], ctx.staged[c], ctx.staged_count[c]);
+    stored += ctx.staged_count[c];
+  }
+
+  portENTER_CRITICAL(&s_interval_lock);
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    adc_accum_merge(&s_interval, &ctx.acc, c);
+  }
+  portEXIT_CRITICAL(&s_interval_lock);
+
+  s_stats.frames++;
+  s_stats.samples += stored;
+  s_stats.dropped += ctx.dropped;
+}
+
+static void adc_acquisition_task(void *pvParameters) {
+  static uint8_t frame[CONV_FRAME_SIZE] __attribute__((aligned(4)));
+
+  while (true) {
+#if ADC_DRIVER_EVENT_DRIVEN
+    // La CPU duerme aquí hasta que la ISR avisa de que hay tramas listas
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NOTIFY_TIMEOUT_MS));
+    const uint32_t timeout_ms = 0;
+#else
+    const uint32_t timeout_ms = READ_TIMEOUT_MS;
+#endif
+
+    // Drenar todas las tramas pendientes; varias notificaciones se agrupan en una
+    while (true) {
+      uint32_t out_len = 0;
+      esp_err_t ret = adc_continuous_read(s_handle, frame, sizeof(frame), &out_len, timeout_ms);
+      if (ret == ESP_OK) {
+        adc_process_frame(frame, out_len);
+        continue;
+      }
+      if (ret != ESP_ERR_TIMEOUT) {
+        // ADC detenido (light sleep o entre ráfagas del modo adaptativo):
+        // esperar sin girar en vacío
+        if (ret != ESP_ERR_INVALID_STATE) s_stats.read_errors++;
+#if ADC_DRIVER_EVENT_DRIVEN
+        // El primer on_conv_done tras adc_continuous_start despierta la tarea
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(READ_TIMEOUT_MS));
+#else
+        vTaskDelay(pdMS_TO_TICKS(READ_TIMEOUT_MS));
+#endif
+      }
+      break;
+    }
+  }
+}
+
+// Programa el patrón a la frecuencia indicada (con el ADC parado) y reinicia
+// los decimadores para la nueva tasa por canal
+static esp_err_t adc_driver_configure(adc_continuous_handle_t handle, uint32_t sample_freq_hz) {
+  adc_digi_pattern_config_t pattern[NUM_CHANNELS];
+
+  for (int i = 0; i < NUM_CHANNELS; i++) {
+    pattern[i].atten = ADC_DRIVER_ATTEN;
+    pattern[i].channel = adc_channels[i];
+    pattern[i].unit = ADC_UNIT_1;
+    pattern[i].bit_width = ADC_BITWIDTH_12;
+    adc_decim_init(&s_decim[i], sample_freq_hz / NUM_CHANNELS);
+  }
+
+  adc_continuous_config_t dig_cfg = {
+    .sample_freq_hz = sample_freq_hz,
+    .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+    .format = ADC_DIGI_OUTPUT_FORMAT_TYPE1,
+    .pattern_num = NUM_CHANNELS,
+    .adc_pattern = pattern,
+  };
+
+  esp_err_t ret = adc_continuous_config(handle, &dig_cfg);
+  if (ret == ESP_OK) s_sample_freq_hz = sample_freq_hz;
+  return ret;
+}
+
+#if CONFIG_ADC_ADAPTIVE
+static esp_err_t adc_adaptive_init(void);
+#endif
+
+esp_err_t adc_driver_init(adc_continuous_handle_t *out_handle) {
+  // Antes de arrancar el DMA: adc_cali solo se usa si no hay tabla en NVS
+  adc_calib_init();
+
+  adc_continuous_handle_t handle;
+  adc_continuous_handle_cfg_t handle_cfg = {
+    .max_store_buf_size = 1024,
+    .conv_frame_size = CONV_FRAME_SIZE,
+  };
+  ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_cfg, &handle));
+
+  memset(s_channel_index, -1, sizeof(s_channel_index));
+  for (int i = 0; i < NUM_CHANNELS; i++) {
+    s_channel_index[adc_channels[i]] = i;
+    adc_ring_reset(&s_rings[i]);
+    adc_accum_reset(&s_interval, i);
+  }
+
+  ESP_ERROR_CHECK(adc_driver_configure(handle, ADC_DRIVER_SAMPLE_FREQ_HZ));
+
+  uint32_t out_mhz = adc_decim_output_rate_mhz(&s_decim[0], ADC_DRIVER_SAMPLE_FREQ_HZ / NUM_CHANNELS);
+  ESP_LOGI(TAG, "%d canal(es), decimador CIC R=%lu + FIR /%d: salida %lu.%03lu Hz",
+           (int)NUM_CHANNELS, s_decim[0].ratio, ADC_DECIM_FIR_FACTOR, out_mhz / 1000, out_mhz % 1000);
+  s_handle = handle;
+
+  // La tarea debe existir antes de registrar callbacks que la notifican
+  if (xTaskCreate(adc_acquisition_task, "adc_acq", ACQ_TASK_STACK, NULL, ACQ_TASK_PRIORITY, &s_acq_task) != pdPASS) {
+    ESP_LOGE(TAG, "No se pudo crear la tarea de adquisición");
+    return ESP_ERR_NO_MEM;
+  }
+
+  adc_continuous_evt_cbs_t cbs = {
+#if ADC_DRIVER_EVENT_DRIVEN
+    .on_conv_done = adc_on_conv_done,
+#endif
+    .on_pool_ovf = adc_on_pool_ovf,
+  };
+  ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(handle, &cbs, NULL));
+
+#if CONFIG_ADC_ADAPTIVE
+  // El ADC queda parado: cada adc_driver_capture() decide cómo adquirir
+  ESP_ERROR_CHECK(adc_adaptive_init());
+#else
+  ESP_ERROR_CHECK(adc_continuous_start(handle));
+#endif
+
+  *out_handle = handle;
+  return ESP_OK;
+
+}
+
+int adc_driver_num_channels(void) {
+  return NUM_CHANNELS;
+}
+
+int adc_driver_get_channels(adc_channel_result_t *results, int max_channels) {
+  int n = (max_channels < NUM_CHANNELS) ? max_channels : NUM_CHANNELS;
+  for (int i = 0; i < n; i++) {
+    memset(&results[i], 0, sizeof(results[i]));
+    results[i].channel = adc_channels[i];
+  }
+  return n;
+}
+
+static int adc_channel_slot(uint8_t channel) {
+  return (channel < MAX_HW_CHANNELS) ? s_channel_index[channel] : -1;
+}
+
+static void adc_fill_result(adc_channel_result_t *result, const adc_accum_t *acc, int slot) {
+  uint32_t n = (slot < 0) ? 0 : acc->count[slot];
+  result->samples = n;
+  if (n == 0) {
+    result->average = result->min = result->max = 0;
+    result->variance = 0;
+    result->filtered = 0;
+    return;
+  }
+
+  uint32_t mean = (uint32_t)(acc->sum[slot] / n);
+  result->average = mean;
+  result->min = acc->min[slot];
+  result->max = acc->max[slot];
+  // Var = E[x²] - E[x]²
+  uint64_t mean_sq = acc->sumsq[slot] / n;
+  uint64_t sq_mean = (uint64_t)mean * mean;
+  result->variance = (mean_sq > sq_mean) ? (uint32_t)(mean_sq - sq_mean) : 0;
+
+  // Media de la ventana en Q12.4 (el resto de la división aporta los bits fraccionarios)
+  uint16_t mean_q = (uint16_t)((acc->sum[slot] << ADC_DECIM_FRAC_BITS) / n);
+#if CONFIG_ADC_ADAPTIVE
+  // Las capturas adaptativas son más cortas que el asentamiento del FIR
+  // (ADC_DECIM_FIR_TAPS salidas del CIC, ~420 ms a 50 Hz) y el oneshot no pasa
+  // por el decimador: se usa siempre la media, que abarca periodos enteros de
+  // red y también rechaza 50/100 Hz
+  result->filtered = mean_q;
+#else
+  // Hasta que el FIR tiene historia completa se usa la media escalada
+  const adc_decim_t *decim = &s_decim[slot];
+  result->filtered = decim->ready ? decim->output : mean_q;
+#endif
+}
+
+int adc_driver_read_multi(adc_continuous_handle_t handle, adc_channel_result_t *results, int num_channels) {
+  return adc_driver_read_window(results, num_channels, ADC_DRIVER_DEFAULT_WINDOW_MS);
+}
+
+int adc_driver_read_window(adc_channel_result_t *results, int num_channels, uint32_t window_ms) {
+  const uint32_t rate_per_channel = s_sample_freq_hz / NUM_CHANNELS;
+  uint32_t wanted = (window_ms * rate_per_channel) / 1000;
+  if (wanted == 0) wanted = 1;
+
+  adc_accum_t acc;
+  int total = 0;
+  for (int i = 0; i < num_channels; i++) {
+    int slot = adc_channel_slot(results[i].channel);
+    if (slot < 0) {
+      ESP_LOGW(TAG, "Canal %d no configurado", results[i].channel);
+      adc_fill_result(&results[i], &acc, slot);
+      continue;
+    }
+
+    adc_accum_reset(&acc, slot);
+    total += adc_ring_accumulate_recent(&s_rings[slot], wanted, &acc, slot);
+    adc_fill_result(&results[i], &acc, slot);
+  }
+
+  return total;
+}
+
+int adc_driver_read_interval(adc_channel_result_t *results, int num_channels) {
+  adc_accum_t snapshot;
+
+  portENTER_CRITICAL(&s_interval_lock);
+  snapshot = s_interval;
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    adc_accum_reset(&s_interval, c);
+  }
+  portEXIT_CRITICAL(&s_interval_lock);
+
+  int total = 0;
+  for (int i = 0; i < num_channels; i++) {
+    int slot = adc_channel_slot(results[i].channel);
+    adc_fill_result(&results[i], &snapshot, slot);
+    total += results[i].samples;
+  }
+
+  return total;
+}
+
+uint32_t adc_driver_copy_recent(uint8_t channel, uint16_t *out, uint32_t count) {
+  int slot = adc_channel_slot(channel);
+  if (slot < 0) {
+    ESP_LOGW(TAG, "Canal %d no configurado", channel);
+    return 0;
+  }
+  return adc_ring_copy_recent(&s_rings[slot], out, count);
+}
+
+// Historia de la captura anterior: tras una parada (ráfagas, light sleep) las
+// muestras no son contiguas en el tiempo
+static void adc_reset_history(void) {
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    adc_ring_reset(&s_rings[c]);
+    adc_decim_init(&s_decim[c], s_sample_freq_hz / NUM_CHANNELS);
+  }
+}
+
+esp_err_t adc_driver_stop(void) {
+#if CONFIG_ADC_ADAPTIVE
+  // El ADC ya está parado fuera de cada captura
+  return ESP_OK;
+#else
+  return adc_continuous_stop(s_handle);
+#endif
+}
+
+esp_err_t adc_driver_start(uint32_t window_ms) {
+#if CONFIG_ADC_ADAPTIVE
+  return ESP_OK;
+#else
+  // Las tramas que quedaron en el pool y la historia son de antes de la parada
+  adc_continuous_flush_pool(s_handle);
+  adc_reset_history();
+  esp_err_t ret = adc_continuous_start(s_handle);
+  if (ret != ESP_OK) return ret;
+
+  const uint32_t wanted = ((uint64_t)window_ms * (s_sample_freq_hz / NUM_CHANNELS)) / 1000;
+  const int64_t deadline = esp_timer_get_time() + (int64_t)(window_ms + START_TIMEOUT_MARGIN_MS) * 1000;
+  while (adc_ring_written(&s_rings[0]) < wanted) {
+    if (esp_timer_get_time() > deadline) return ESP_ERR_TIMEOUT;
+    vTaskDelay(pdMS_TO_TICKS(START_POLL_MS));
+  }
+  return ESP_OK;
+#endif
+}
+
+void adc_driver_get_stats(adc_driver_stats_t *out) {
+  out->frames = s_stats.frames;
+  out->samples = s_stats.samples;
+  out->dropped = s_stats.dropped;
+  out->overflows = s_stats.overflows;
+  out->read_errors = s_stats.read_errors;
+}
+
+// --- Adquisición adaptativa y ciclo de trabajo ---
+
+// Energía estimada por muestra: potencia activa del ADC × tiempo encendido
+static uint32_t adc_energy_per_sample_nj(int64_t on_us, uint32_t samples) {
+  if (samples == 0) return 0;
+  return (uint32_t)(((uint64_t)CONFIG_ADC_ACTIVE_POWER_UW * on_us) / 1000 / samples);
+}
+
+const char *adc_driver_mode_name(adc_driver_mode_t mode) {
+  switch (mode) {
+    case ADC_DRIVER_MODE_BURST: return "ráfaga";
+    case ADC_DRIVER_MODE_ONESHOT: return "oneshot";
+    default: return "continuo";
+  }
+}
+
+#if CONFIG_ADC_ADAPTIVE
+#include "esp_adc/adc_oneshot.h"
+#include "esp_rom_sys.h"
+
+#define ONESHOT_MAX_SAMPLES 64
+_Static_assert(ONESHOT_MAX_SAMPLES <= ADC_FRAME_SAMPLES, "La captura oneshot no cabe en un push del buffer circular");
+#define MIN_SAMPLES 16
+#define BURST_MARGIN_MS 10  // Deja llegar la última trama completa antes de parar
+#define MAINS_PERIOD_MS (1000 / CONFIG_ADC_DECIM_CIC_RATE_HZ)
+#define TARGET_VARIANCE ((uint32_t)CONFIG_ADC_ADAPTIVE_TARGET_NOISE_LSB * CONFIG_ADC_ADAPTIVE_TARGET_NOISE_LSB)
+#define NO_VARIANCE UINT32_MAX
+
+static adc_oneshot_unit_handle_t s_oneshot = NULL;
+static uint32_t s_last_variance = NO_VARIANCE;  // Sin medida: primera captura conservadora
+
+static esp_err_t adc_adaptive_init(void) {
+  adc_oneshot_unit_init_cfg_t unit_cfg = {
+    .unit_id = ADC_UNIT_1,
+  };
+  esp_err_t ret = adc_oneshot_new_unit(&unit_cfg, &s_oneshot);
+  if (ret != ESP_OK) return ret;
+
+  adc_oneshot_chan_cfg_t chan_cfg = {
+    .atten = ADC_DRIVER_ATTEN,
+    .bitwidth = ADC_BITWIDTH_12,
+  };
+  for (int i = 0; i < NUM_CHANNELS && ret == ESP_OK; i++) {
+    ret = adc_oneshot_config_channel(s_oneshot, adc_channels[i], &chan_cfg);
+  }
+  return ret;
+}
+
+static void adc_interval_snapshot(adc_accum_t *out) {
+  portENTER_CRITICAL(&s_interval_lock);
+  *out = s_interval;
+  portEXIT_CRITICAL(&s_interval_lock);
+}
+
+// Mayor varianza por canal entre dos instantáneas del acumulador de intervalo
+static uint32_t adc_variance_between(const adc_accum_t *before, const adc_accum_t *after, uint32_t *samples) {
+  uint32_t worst = 0;
+  *samples = 0;
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    uint32_t n = after->count[c] - before->count[c];
+    if (n == 0) continue;
+    *samples += n;
+    uint32_t mean = (uint32_t)((after->sum[c] - before->sum[c]) / n);
+    uint64_t mean_sq = (after->sumsq[c] - before->sumsq[c]) / n;
+    uint64_t sq_mean = (uint64_t)mean * mean;
+    uint32_t variance = (mean_sq > sq_mean) ? (uint32_t)(mean_sq - sq_mean) : 0;
+    if (variance > worst) worst = variance;
+  }
+  return worst;
+}
+
+// Muestras por canal para que el ruido de la media quede por debajo del objetivo:
+// Var(media) = Var / n  =>  n = Var / objetivo²
+static uint32_t adc_adaptive_samples(void) {
+  if (s_last_variance == NO_VARIANCE) return UINT32_MAX;
+  uint32_t n = (s_last_variance + TARGET_VARIANCE - 1) / TARGET_VARIANCE;
+  return (n < MIN_SAMPLES) ? MIN_SAMPLES : n;
+}
+
+// Frecuencia total redondeada hacia arriba para que la tasa por canal sea un
+// múltiplo exacto de la del CIC (ceros en 50/100 Hz), sin pasar del máximo
+static uint32_t adc_exact_freq(uint64_t freq) {
+  const uint32_t step = NUM_CHANNELS * CONFIG_ADC_DECIM_CIC_RATE_HZ;
+  const uint32_t max = (SOC_ADC_SAMPLE_FREQ_THRES_HIGH / step) * step;
+  uint64_t rounded = ((freq + step - 1) / step) * step;
+  return (rounded > max) ? max : (uint32_t)rounded;
+}
+
+static esp_err_t adc_capture_burst(uint32_t samples, adc_driver_power_t *power) {
+  // Frecuencia mínima del controlador digital y la ventana justa; solo se sube
+  // la frecuencia si las muestras no caben en la ventana máxima
+  uint32_t freq = adc_exact_freq(SOC_ADC_SAMPLE_FREQ_THRES_LOW);
+  uint64_t total = (uint64_t)samples * NUM_CHANNELS;
+  uint32_t window_ms = CONFIG_ADC_ADAPTIVE_MAX_WINDOW_MS;
+  if (samples != UINT32_MAX) {
+    uint64_t needed_ms = (total * 1000 + freq - 1) / freq;
+    if (needed_ms > CONFIG_ADC_ADAPTIVE_MAX_WINDOW_MS) {
+      uint64_t needed_freq = (total * 1000 + CONFIG_ADC_ADAPTIVE_MAX_WINDOW_MS - 1) / CONFIG_ADC_ADAPTIVE_MAX_WINDOW_MS;
+      freq = adc_exact_freq(needed_freq);
+    } else {
+      window_ms = (uint32_t)needed_ms;
+    }
+  }
+  // Ventana en periodos enteros de red: la media también rechaza 50/100 Hz
+  window_ms = ((window_ms + MAINS_PERIOD_MS - 1) / MAINS_PERIOD_MS) * MAINS_PERIOD_MS;
+
+  if (freq != s_sample_freq_hz) {
+    esp_err_t ret = adc_driver_configure(s_handle, freq);
+    if (ret != ESP_OK) return ret;
+  }
+  adc_reset_history();
+
+  adc_accum_t before, after;
+  adc_interval_snapshot(&before);
+
+  int64_t start = esp_timer_get_time();
+  esp_err_t ret = adc_continuous_start(s_handle);
+  if (ret != ESP_OK) return ret;
+  vTaskDelay(pdMS_TO_TICKS(window_ms + BURST_MARGIN_MS));
+  adc_continuous_stop(s_handle);
+  int64_t on_us = esp_timer_get_time() - start;
+
+  adc_interval_snapshot(&after);
+  uint32_t captured;
+  s_last_variance = adc_variance_between(&before, &after, &captured);
+
+  power->mode = ADC_DRIVER_MODE_BURST;
+  power->sample_freq_hz = freq;
+  power->window_ms = window_ms;
+  power->samples = captured;
+  power->on_us = on_us;
+  return (captured > 0) ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+static esp_err_t adc_capture_oneshot(uint32_t samples, adc_driver_power_t *power) {
+  static uint16_t staged[NUM_CHANNELS][ONESHOT_MAX_SAMPLES];
+  adc_accum_t acc;
+
+  // Lecturas repartidas en un periodo de red para conservar su rechazo
+  const uint32_t spacing_us = (MAINS_PERIOD_MS * 1000) / samples;
+  const int64_t tick_us = portTICK_PERIOD_MS * 1000;
+  int64_t on_us = 0;
+
+  adc_reset_history();
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    adc_accum_reset(&acc, c);
+  }
+
+  const int64_t t_start = esp_timer_get_time();
+  for (uint32_t i = 0; i < samples; i++) {
+    for (int c = 0; c < NUM_CHANNELS; c++) {
+      int raw = 0;
+      int64_t t0 = esp_timer_get_time();
+      esp_err_t ret = adc_oneshot_read(s_oneshot, adc_channels[c], &raw);
+      on_us += esp_timer_get_time() - t0;
+      if (ret != ESP_OK) {
+        s_stats.read_errors++;
+        return ret;
+      }
+      staged[c][i] = (uint16_t)raw;
+      adc_accum_add(&acc, c, (uint16_t)raw);
+    }
+
+    // Hasta la siguiente lectura: los ticks enteros durmiendo y solo el resto
+    // en espera activa, que sí cuenta como tiempo encendido
+    int64_t deadline = t_start + (int64_t)(i + 1) * spacing_us;
+    int64_t remaining = deadline - esp_timer_get_time();
+    if (remaining >= tick_us) {
+      vTaskDelay((TickType_t)(remaining / tick_us));
+      remaining = deadline - esp_timer_get_time();
+    }
+    if (remaining > 0) {
+      esp_rom_delay_us((uint32_t)remaining);
+      on_us += remaining;
+    }
+  }
+
+  // Mismo destino que las tramas DMA: buffers circulares y acumulador de intervalo
+  portENTER_CRITICAL(&s_interval_lock);
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    adc_accum_merge(&s_interval, &acc, c);
+  }
+  portEXIT_CRITICAL(&s_interval_lock);
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    adc_ring_push(&s_rings[c], staged[c], samples);
+  }
+  s_stats.samples += samples * NUM_CHANNELS;
+
+  adc_accum_t empty;
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    adc_accum_reset(&empty, c);
+  }
+  uint32_t captured;
+  s_last_variance = adc_variance_between(&empty, &acc, &captured);
+
+  power->mode = ADC_DRIVER_MODE_ONESHOT;
+  power->sample_freq_hz = 0;
+  power->window_ms = MAINS_PERIOD_MS;
+  power->samples = captured;
+  power->on_us = on_us;
+  return ESP_OK;
+}
+
+esp_err_t adc_driver_capture(uint32_t interval_ms, adc_driver_power_t *power) {
+  adc_driver_power_t result = {0};
+  uint32_t samples = adc_adaptive_samples();
+
+  esp_err_t ret;
+  if (interval_ms >= CONFIG_ADC_ADAPTIVE_ONESHOT_INTERVAL_MS && samples <= ONESHOT_MAX_SAMPLES) {
+    ret = adc_capture_oneshot(samples, &result);
+  } else {
+    ret = adc_capture_burst(samples, &result);
+  }
+
+  if (interval_ms > 0) {
+    result.duty_cycle = (float)result.on_us / (interval_ms * 1000.0f);
+  }
+  result.energy_per_sample_nj = adc_energy_per_sample_nj(result.on_us, result.samples);
+  if (power) *power = result;
+
+  if (ret != ESP_OK) {
+    ESP_LOGW(TAG, "Captura %s fallida: %s", adc_driver_mode_name(result.mode), esp_err_to_name(ret));
+  }
+  return ret;
+}
+
+#else
+
+esp_err_t adc_driver_capture(uint32_t interval_ms, adc_driver_power_t *power) {
+  // ADC siempre encendido: las muestras ya están en los buffers circulares
+  if (power) {
+    power->mode = ADC_DRIVER_MODE_CONTINUOUS;
+    power->sample_freq_hz = s_sample_freq_hz;
+    power->window_ms = interval_ms;
+    power->samples = (uint32_t)(((uint64_t)s_sample_freq_hz * interval_ms) / 1000);
+    power->on_us = (int64_t)interval_ms * 1000;
+    power->duty_cycle = 1.0f;
+    power->energy_per_sample_nj = (uint32_t)(((uint64_t)CONFIG_ADC_ACTIVE_POWER_UW * 1000) / s_sample_freq_hz);
+  }
+  return ESP_OK;
+}
+
+#endif
@@ -2,22 +2,32 @@
 #include <stdint.h>
 #include <math.h>
 #include "esp_log.h"
+#include "sdkconfig.h"
+#if CONFIG_LDR_LUT_BENCHMARK
+#include "esp_cpu.h"
+#endif
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
 #include "driver/i2c_master.h"
-#include "esp_adc/adc_continuous.h"
+#include "adc_driver.h"
+#include "adc_calib.h"
 #include "ldr_monitor.h"
+#include "seg_display.h"
+#include "light_lut.h"
 #include "ssd1306.h"
+#include "ssd1306_font.h"
+#include "ssd1306_group.h"
+#include "ssd1306_widget.h"
 
 #define TAG "LDR_MONITOR"
-#define BUF_SIZE 1024
-#define FRAME_SIZE 256
-#define SAMPLE_FREQUENCY_HZ 20000
+#define LDR_CHANNEL ADC_CHANNEL_0
+#define LDR_WINDOW_MS 200 // Ventana de promediado sobre las muestras más recientes
+#define MONITOR_PERIOD_MS 1000
 
 #define VCC 3.3
 #define VCC_MAX_VALUE 4095.0
-#define FIXED_RESISTOR 10000.0 // 10kΩ
+#define FIXED_RESISTOR ((double)CONFIG_LDR_FIXED_RESISTOR)
 
 // Pines display 7 segmentos BCD
 #define SEG_A_1 2
@@ -29,60 +39,124 @@
 #define SEG_C_2 21
 #define SEG_D_2 22
 
-#define BCD_WEIGHTS 4
-#define N 2 // número de dígitos
 
 // OLED I2C
 #define I2C_MASTER_SCL_IO 23
 #define I2C_MASTER_SDA_IO 25
 #define OLED_ADDR 0x3C
+#define OLED_ADDR_2 0x3D // Segundo panel opcional en el mismo bus
 #define OLED_WIDTH 128
 #define OLED_HEIGHT 64
-
-gpio_num_t pins_display_1[BCD_WEIGHTS] = { SEG_A_1, SEG_B_1, SEG_C_1, SEG_D_1 };
-gpio_num_t pins_display_2[BCD_WEIGHTS] = { SEG_A_2, SEG_B_2, SEG_C_2, SEG_D_2 };
-
-static adc_continuous_handle_t adc_config(void);
-static uint16_t adc_read(adc_continuous_handle_t);
+#define OLED_COLS 16 // Caracteres de 8x8 por línea
+#define OLED_BENCHMARK_FRAMES 50
+#define OLED_MAX_FPS 10
+#define OLED_2_MAX_FPS 2 // El panel grande solo muestra el nivel
+#define OLED_RENDER_PRIORITY 1 // Por debajo de la tarea del sensor
+
+// Un dígito por fila, de más a menos significativo
+static const gpio_num_t pins_display[][SEG_DISPLAY_BCD_WEIGHTS] = {
+    { SEG_A_1, SEG_B_1, SEG_C_1, SEG_D_1 },
+    { SEG_A_2, SEG_B_2, SEG_C_2, SEG_D_2 },
+};
+#define N (sizeof(pins_display) / sizeof(pins_display[0])) // número de dígitos
+
+static seg_display_t s_segments;
+
+// Paneles y servicio de grupo fuera de la pila de la tarea (dos buffers de 1 KB por panel)
+static SSD1306_t s_oled;
+static ssd1306_group_t s_oled_group;
+static int s_oled_panel;
+#if CONFIG_LDR_OLED_SECOND_PANEL
+static SSD1306_t s_oled_2;
+static int s_oled_2_panel;
+#endif
+
+// Pantalla: tres campos de texto, barra de nivel e histórico
+static ssd1306_value_t s_level_field;
+static ssd1306_value_t s_ohm_field;
+static ssd1306_value_t s_kohm_field;
+static ssd1306_bar_t s_level_bar;
+static ssd1306_scroll_chart_t s_level_history; // Últimas 128 lecturas, desplazadas por el panel
+
+static int adc_read(void);
 static float calculate_resistance(uint16_t);
+#if CONFIG_LDR_LUT_BENCHMARK
 static uint8_t calculate_light_level(float);
-
-static void configure_segment_display(gpio_num_t *);
-static void write_bcd_digit(uint8_t, gpio_num_t *);
-static void get_digits(uint8_t, uint8_t [N]);
+static void benchmark_light_lut(void);
+#endif
 
 static void init_oled(SSD1306_t *dev);
-static void oled_show_light_bar(SSD1306_t *dev, uint8_t level, float resistance);
+static void init_oled_widgets(void);
+static bool oled_show_light_bar(SSD1306_t *dev, uint8_t level, float resistance);
+#if CONFIG_LDR_OLED_SECOND_PANEL
+static void init_oled_2(SSD1306_t *dev, const SSD1306_t *bus);
+static bool oled_2_show_level(SSD1306_t *dev, uint8_t level);
+#endif
 
 // ---------------- TASK ----------------
 static void ldr_monitor_task(void *pvParameters) {
-    adc_continuous_handle_t adc_handle = adc_config();
-
-    configure_segment_display(pins_display_1);
-    configure_segment_display(pins_display_2);
-
-    SSD1306_t dev;
-    init_oled(&dev);
+    adc_continuous_handle_t adc_handle;
+    ESP_ERROR_CHECK(adc_driver_init(&adc_handle));
+
+    ESP_ERROR_CHECK(seg_display_init(&s_segments, pins_display, N));
+
+    // Un único task de render reparte el bus entre los paneles, el principal primero
+    init_oled(&s_oled);
+    ssd1306_group_init(&s_oled_group);
+    s_oled_panel = ssd1306_group_add(&s_oled_group, &s_oled, 1, OLED_MAX_FPS);
+#if CONFIG_LDR_OLED_SECOND_PANEL
+    init_oled_2(&s_oled_2, &s_oled);
+    s_oled_2_panel = ssd1306_group_add(&s_oled_group, &s_oled_2, 0, OLED_2_MAX_FPS);
+    SSD1306_t *canvas_2 = ssd1306_group_canvas(&s_oled_group, s_oled_2_panel);
+#endif
+    ESP_ERROR_CHECK(ssd1306_group_start(&s_oled_group, OLED_RENDER_PRIORITY));
+    SSD1306_t *canvas = ssd1306_group_canvas(&s_oled_group, s_oled_panel);
+    init_oled_widgets();
+
+#if CONFIG_LDR_LUT_BENCHMARK
+    benchmark_light_lut();
+#endif
+#if CONFIG_ADC_DECIM_BENCHMARK
+    adc_decim_benchmark(ADC_DRIVER_SAMPLE_FREQ_HZ / adc_driver_num_channels());
+#endif
 
     while (1) {
-        uint16_t raw_value = adc_read(adc_handle);
+        // Con CONFIG_ADC_ADAPTIVE captura aquí una ráfaga u oneshot; si no, no hace nada
+        adc_driver_power_t power;
+        adc_driver_capture(MONITOR_PERIOD_MS, &power);
+
+        int raw_value = adc_read();
+        if (raw_value < 0) {
+            // Sin datos (arranque o tarea de adquisición parada): no se
+            // actualizan los displays y se espera una ventana antes de reintentar
+            vTaskDelay(pdMS_TO_TICKS(LDR_WINDOW_MS));
+            continue;
+        }
         float resistance = calculate_resistance(raw_value);
 
-        uint8_t light_level = calculate_light_level(resistance);
+        // Tabla generada en compilación sobre la tensión calibrada: sin log10f por lectura
+        uint8_t light_level = light_level_from_raw(raw_value);
 
         ESP_LOGI(TAG, "Raw: %d, R=%.1f Ohm, Luz=%d",
                  raw_value, resistance, light_level);
 
-        // Displays 7 segmentos
-        uint8_t digits[N];
-        get_digits(light_level, digits);
-        write_bcd_digit(digits[0], pins_display_1);
-        write_bcd_digit(digits[1], pins_display_2);
+        // Displays 7 segmentos: no escribe nada si el nivel no ha cambiado
+        seg_display_show(&s_segments, light_level);
 
-        // OLED
-        oled_show_light_bar(&dev, light_level, resistance);
+        // OLED: se dibuja en el buffer trasero; la tarea del grupo hace la transferencia I2C
+        if (oled_show_light_bar(canvas, light_level, resistance)) {
+            ssd1306_group_present(&s_oled_group, s_oled_panel);
+        }
+#if CONFIG_LDR_OLED_SECOND_PANEL
+        if (oled_2_show_level(canvas_2, light_level)) {
+            ssd1306_group_present(&s_oled_group, s_oled_2_panel);
+        }
+#endif
+
+        ESP_LOGI(TAG, "ADC %s: duty %.3f%%, %lu nJ/sample",
+                 adc_driver_mode_name(power.mode), power.duty_cycle * 100.0f, power.energy_per_sample_nj);
 
-        vTaskDelay(pdMS_TO_TICKS(1000));
+        vTaskDelay(pdMS_TO_TICKS(MONITOR_PERIOD_MS));
     }
 }
 
@@ -91,74 +165,43 @@ void ldr_monitor_start(void) {
 }
 
 // ---------------- FUNCIONES ----------------
-static adc_continuous_handle_t adc_config(void) {
-    adc_continuous_handle_t handle = NULL;
-
-    adc_continuous_handle_cfg_t adc_handle_cfg = {
-        .max_store_buf_size = BUF_SIZE,
-        .conv_frame_size = FRAME_SIZE,
+// Código filtrado de 12 bits, -1 si el buffer circular aún no tiene muestras
+static int adc_read(void) {
+    adc_channel_result_t result = {
+        .channel = LDR_CHANNEL,
+        .average = 0,
     };
-    ESP_ERROR_CHECK(adc_continuous_new_handle(&adc_handle_cfg, &handle));
 
-    static adc_digi_pattern_config_t adc_pattern = {
-        .atten = ADC_ATTEN_DB_12,
-        .channel = ADC_CHANNEL_0,
-        .unit = ADC_UNIT_1,
-        .bit_width = ADC_BITWIDTH_12,
-    };
-
-    adc_continuous_config_t dig_cfg = {
-        .sample_freq_hz = SAMPLE_FREQUENCY_HZ,
-        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
-        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE1,
-        .pattern_num = 1,
-        .adc_pattern = &adc_pattern,
-    };
-
-    ESP_ERROR_CHECK(adc_continuous_config(handle, &dig_cfg));
-    ESP_ERROR_CHECK(adc_continuous_start(handle));
-
-    return handle;
-}
-
-static uint16_t adc_read(adc_continuous_handle_t handle) {
-    uint8_t buffer[FRAME_SIZE];
-    uint32_t out_length = 0;
-    uint32_t sum = 0;
-    int num_samples = 0;
-
-    esp_err_t ret = adc_continuous_read(handle, buffer, sizeof(buffer),
-                                        &out_length, 1000);
-
-    if (ret == ESP_OK) {
-        num_samples = out_length / sizeof(adc_digi_output_data_t);
-
-        for (int i = 0; i < out_length; i += sizeof(adc_digi_output_data_t)) {
-            adc_digi_output_data_t *p = (adc_digi_output_data_t *)&buffer[i];
-            uint16_t raw_value = p->type1.data;
-            sum += raw_value;
-        }
-
-        return (num_samples > 0) ? (sum / num_samples) : 0;
-    } else {
-        ESP_LOGW(TAG, "No ADC data read (%s)", esp_err_to_name(ret));
-        return 0;
+    // Lectura no bloqueante de las muestras más recientes del buffer circular
+    if (adc_driver_read_window(&result, 1, LDR_WINDOW_MS) <= 0) {
+        ESP_LOGW(TAG, "No ADC data available");
+        return -1;
     }
+    // Salida decimada CIC+FIR (media de la captura en modo adaptativo), sin
+    // rizado de red y redondeada a 12 bits
+    int raw = (result.filtered + (1 << (ADC_DECIM_FRAC_BITS - 1))) >> ADC_DECIM_FRAC_BITS;
+    return (raw > 4095) ? 4095 : raw;
 }
 
 static float calculate_resistance(uint16_t raw_value) {
     if (raw_value > VCC_MAX_VALUE) return -1.0f;
 
-    float v_adc = ((float)raw_value / VCC_MAX_VALUE) * VCC;
-    if (v_adc <= 0.0f) return 0.0f;
-    if (v_adc >= VCC)  return -1.0f;
+    // Tensión calibrada con la tabla derivada de eFuse (sin adc_cali por muestra)
+    uint16_t mv = adc_calib_raw_to_mv(raw_value);
+    if (mv == 0) return 0.0f;
+
+    // Mismo recorte que gen_light_lut.py para que tabla y referencia coincidan
+    float v_adc = mv / 1000.0f;
+    if (v_adc >= VCC) v_adc = VCC - 0.001f;
 
     return FIXED_RESISTOR * (v_adc / (VCC - v_adc));
 }
 
+#if CONFIG_LDR_LUT_BENCHMARK
+// Ruta en coma flotante original; se conserva como referencia para el benchmark
 static uint8_t calculate_light_level(float resistance) {
-    const float R_DARK = 100000.0f;
-    const float R_LIGHT = 1000.0f;
+    const float R_DARK = (float)CONFIG_LDR_R_DARK;
+    const float R_LIGHT = (float)CONFIG_LDR_R_LIGHT;
 
     float level = 100.0f * (log10f(R_DARK / resistance) / log10f(R_DARK / R_LIGHT));
 
@@ -168,56 +211,114 @@ static uint8_t calculate_light_level(float resistance) {
     return (uint8_t)roundf(level);
 }
 
-static void configure_segment_display(gpio_num_t *pins){
-    for(int i = 0; i < BCD_WEIGHTS; i++){
-        gpio_reset_pin(pins[i]);
-        gpio_set_direction(pins[i], GPIO_MODE_OUTPUT);
+// Ambas rutas parten del código ADC y pasan por la tabla de calibración
+static void benchmark_light_lut(void) {
+    volatile uint32_t sink = 0;
+    int mismatches = 0;
+
+    uint32_t start = esp_cpu_get_cycle_count();
+    for (uint16_t raw = 0; raw < ADC_CALIB_TABLE_SIZE; raw++) {
+        sink += calculate_light_level(calculate_resistance(raw));
     }
-}
+    uint32_t float_cycles = esp_cpu_get_cycle_count() - start;
 
-static void write_bcd_digit(uint8_t digit, gpio_num_t *pins){
-    for (int i = 0; i < 4; i++) {
-        int bit = (digit >> i) & 0x01;
-        gpio_set_level(pins[i], bit);
+    start = esp_cpu_get_cycle_count();
+    for (uint16_t raw = 0; raw < ADC_CALIB_TABLE_SIZE; raw++) {
+        sink += light_level_from_raw(raw);
     }
-}
+    uint32_t lut_cycles = esp_cpu_get_cycle_count() - start;
 
-static void get_digits(uint8_t value, uint8_t digits[N]){
-    digits[0] = value / 10;
-    digits[1] = value % 10;
+    for (uint16_t raw = 0; raw < ADC_CALIB_TABLE_SIZE; raw++) {
+        if (calculate_light_level(calculate_resistance(raw)) != light_level_from_raw(raw)) mismatches++;
+    }
+
+    ESP_LOGI(TAG, "Benchmark nivel de luz (%s): float %lu ciclos/muestra, tabla %lu ciclos/muestra, %d discrepancias",
+             adc_calib_is_calibrated() ? "calibrado" : "modelo nominal",
+             float_cycles / ADC_CALIB_TABLE_SIZE, lut_cycles / ADC_CALIB_TABLE_SIZE, mismatches);
+    (void)sink;
 }
+#endif
+
+#if CONFIG_FRAME_RATE_BENCHMARK
+// Tasa de refresco de pantalla completa a cada velocidad del bus, para elegir la del I2C
+static void benchmark_oled_fps(SSD1306_t *dev) {
+    static const uint32_t speeds_hz[] = { 100000, 400000, 1000000 };
+    for (int i = 0; i < sizeof(speeds_hz) / sizeof(speeds_hz[0]); i++) {
+        i2c_bus_speed(dev, speeds_hz[i]);
+        float fps = ssd1306_measure_fps(dev, OLED_BENCHMARK_FRAMES);
+        ESP_LOGI(TAG, "OLED benchmark: %lu kHz -> %.1f frames/s", speeds_hz[i] / 1000, fps);
+    }
+    i2c_bus_speed(dev, 400000);
+}
+#endif
 
 static void init_oled(SSD1306_t *dev) {
     i2c_master_init(dev, I2C_MASTER_SDA_IO, I2C_MASTER_SCL_IO, -1);
     ssd1306_init(dev, OLED_WIDTH, OLED_HEIGHT);
+#if CONFIG_FRAME_RATE_BENCHMARK
+    benchmark_oled_fps(dev);
+#endif
+#if CONFIG_SCROLL_BENCHMARK
+    ssd1306_scroll_benchmark(dev);
+#endif
+#if CONFIG_ROTATE_BENCHMARK
+    ssd1306_rotate_benchmark(dev);
+#endif
+#if CONFIG_FONT_BENCHMARK
+    ssd1306_font_benchmark(dev);
+#endif
     ssd1306_clear_screen(dev, false);
     ssd1306_contrast(dev, 0xff);
 }
 
-static void oled_show_light_bar(SSD1306_t *dev, uint8_t level, float resistance) {
+#if CONFIG_LDR_OLED_SECOND_PANEL
+// Segundo panel en el mismo bus I2C, con la dirección alternativa
+static void init_oled_2(SSD1306_t *dev, const SSD1306_t *bus) {
+    dev->_i2c_bus_handle = bus->_i2c_bus_handle;
+    i2c_device_add(dev, bus->_i2c_num, -1, OLED_ADDR_2);
+    ssd1306_init(dev, OLED_WIDTH, OLED_HEIGHT);
     ssd1306_clear_screen(dev, false);
+    ssd1306_contrast(dev, 0xff);
+}
 
-    char line0[20];
-    snprintf(line0, sizeof(line0), "Luz: %d/99", level);
-    ssd1306_display_text(dev, 0, line0, strlen(line0), false);
-
-    char line1[20];
-    snprintf(line1, sizeof(line1), "R: %.1f Ohm", resistance);
-    ssd1306_display_text(dev, 1, line1, strlen(line1), false);
-
-    char line2[20];
-    snprintf(line2, sizeof(line2), "R: %.2f kOhm", resistance/1000.0);
-    ssd1306_display_text(dev, 2, line2, strlen(line2), false);
-
-    const int num_blocks = 10;
-    int filled_blocks = (level * num_blocks) / 99;
-
-    char bar[num_blocks + 1];
-    for (int i = 0; i < num_blocks; i++) {
-        bar[i] = (i < filled_blocks) ? '#' : '-';
-    }
-    bar[num_blocks] = '\0';
-
-    ssd1306_display_text(dev, 4, bar, strlen(bar), false);
+// Nivel de luz en la fuente de 24 px, centrado en las páginas 2-4
+static bool oled_2_show_level(SSD1306_t *dev, uint8_t level) {
+    static int shown = -1;
+    static int start = 0, end = 0; // Columnas del texto dibujado
+    if (level == shown) return false;
+    shown = level;
+
+    char text[8];
+    snprintf(text, sizeof(text), "%d%%", level);
+    int seg = (OLED_WIDTH - ssd1306_font_text_width(&ssd1306_font_large, text)) / 2;
+    // Borra solo las columnas del texto anterior que el nuevo no cubre
+    if (start < seg) _ssd1306_fill_rect(dev, start, 16, seg - 1, 39, true);
+    int new_end = ssd1306_display_font_text(dev, &ssd1306_font_large, 2, seg, text, false);
+    if (new_end < end) _ssd1306_fill_rect(dev, new_end, 16, end - 1, 39, true);
+    start = seg;
+    end = new_end;
+    return true;
+}
+#endif
+
+static void init_oled_widgets(void) {
+    ssd1306_value_init(&s_level_field, 0, 0, OLED_COLS, "Luz: %.0f/99");
+    ssd1306_value_init(&s_ohm_field, 1, 0, OLED_COLS, "R: %.1f Ohm");
+    ssd1306_value_init(&s_kohm_field, 2, 0, OLED_COLS, "R: %.2f kOhm");
+    ssd1306_bar_init(&s_level_bar, 0, 32, OLED_WIDTH, 8, 99);
+    ssd1306_scroll_chart_init(&s_level_history, 0, 5, 3, OLED_WIDTH, 0, 99);
 }
 
+// Los widgets solo redibujan lo que cambia. El histórico se desplaza una columna
+// por lectura: con CONFIG_CONTENT_SCROLL el panel mueve su GDDRAM y solo viaja la
+// columna nueva (3 bytes); sin él se reenvía cada página desde la primera columna
+// que cambia (3 bytes con luz estable, hasta 3x128 si el histórico varía mucho)
+static bool oled_show_light_bar(SSD1306_t *dev, uint8_t level, float resistance) {
+    bool changed = false;
+    changed |= ssd1306_value_set(dev, &s_level_field, level);
+    changed |= ssd1306_value_set(dev, &s_ohm_field, resistance);
+    changed |= ssd1306_value_set(dev, &s_kohm_field, resistance / 1000.0f);
+    changed |= ssd1306_bar_set(dev, &s_level_bar, level);
+    changed |= ssd1306_scroll_chart_push(dev, &s_level_history, level);
+    return changed;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <stdint.h>
+#include "adc_calib.h"
+
+#define LIGHT_LUT_SIZE 4096  // mV: cubre todo el rango de la atenuación de 12 dB
+
+// Tabla tensión calibrada (mV) -> nivel de luz, generada al compilar
+// (gen_light_lut.py) con la calibración de Kconfig
+extern const uint8_t light_lut[LIGHT_LUT_SIZE];
+
+static inline uint8_t light_level_from_mv(uint16_t mv) {
+  return light_lut[(mv < LIGHT_LUT_SIZE) ? mv : LIGHT_LUT_SIZE - 1];
+}
+
+// Código ADC -> nivel pasando por la calibración de eFuse: dos lecturas de tabla
+static inline uint8_t light_level_from_raw(uint16_t raw) {
+  return light_level_from_mv(adc_calib_raw_to_mv(raw));
+}
@@ -0,0 +1,73 @@
+#include "seg_display.h"
+#include "esp_log.h"
+#include "soc/gpio_reg.h"
+#include "soc/soc.h"
+#include <string.h>
+
+#define TAG "SEG_DISPLAY"
+
+esp_err_t seg_display_init(seg_display_t *disp, const gpio_num_t pins[][SEG_DISPLAY_BCD_WEIGHTS], int digits) {
+  if (digits <= 0 || digits > SEG_DISPLAY_MAX_DIGITS) return ESP_ERR_INVALID_ARG;
+
+  memset(disp, 0, sizeof(*disp));
+  disp->digits = digits;
+
+  uint64_t pin_mask = 0;
+  for (int d = 0; d < digits; d++) {
+    for (int w = 0; w < SEG_DISPLAY_BCD_WEIGHTS; w++) {
+      gpio_num_t pin = pins[d][w];
+      if (!GPIO_IS_VALID_OUTPUT_GPIO(pin)) {
+        ESP_LOGE(TAG, "GPIO%d no puede ser salida (dígito %d)", pin, d);
+        return ESP_ERR_INVALID_ARG;
+      }
+      pin_mask |= 1ULL << pin;
+
+      int bank = pin / 32;
+      uint32_t bit = 1UL << (pin % 32);
+      disp->all_mask[bank] |= bit;
+      for (int v = 0; v < 10; v++) {
+        if ((v >> w) & 1) disp->set_mask[d][v][bank] |= bit;
+      }
+    }
+  }
+
+  gpio_config_t io_conf = {
+    .pin_bit_mask = pin_mask,
+    .mode = GPIO_MODE_OUTPUT,
+    .pull_up_en = GPIO_PULLUP_DISABLE,
+    .pull_down_en = GPIO_PULLDOWN_DISABLE,
+    .intr_type = GPIO_INTR_DISABLE,
+  };
+  return gpio_config(&io_conf);
+}
+
+bool seg_display_show(seg_display_t *disp, uint32_t value) {
+  if (disp->shown && value == disp->value) {
+    disp->skipped++;
+    return false;
+  }
+
+  // El último dígito de la tabla son las unidades
+  uint32_t set[SEG_DISPLAY_BANKS] = { 0 };
+  uint32_t rest = value;
+  for (int d = disp->digits - 1; d >= 0; d--) {
+    const uint32_t *mask = disp->set_mask[d][rest % 10];
+    set[0] |= mask[0];
+    set[1] |= mask[1];
+    rest /= 10;
+  }
+
+  // W1TS pone a 1 los pines del nuevo valor y W1TC apaga el resto de la tabla
+  REG_WRITE(GPIO_OUT_W1TS_REG, set[0]);
+  REG_WRITE(GPIO_OUT_W1TC_REG, disp->all_mask[0] & ~set[0]);
+#ifdef GPIO_OUT1_W1TS_REG
+  if (disp->all_mask[1]) {
+    REG_WRITE(GPIO_OUT1_W1TS_REG, set[1]);
+    REG_WRITE(GPIO_OUT1_W1TC_REG, disp->all_mask[1] & ~set[1]);
+  }
+#endif
+
+  disp->value = value;
+  disp->shown = true;
+  return true;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "driver/gpio.h"
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SEG_DISPLAY_BCD_WEIGHTS 4  // Pines A..D del decodificador, de menor a mayor peso
+#define SEG_DISPLAY_MAX_DIGITS 4
+#define SEG_DISPLAY_BANKS 2        // Registros de salida: GPIO0-31 y GPIO32-39
+
+// --- Displays de 7 segmentos con decodificador BCD ---
+// Las máscaras de set de cada dígito y valor se calculan al iniciar, de modo
+// que mostrar un número son dos escrituras de registro por banco (W1TS y W1TC)
+// que cambian todos los dígitos a la vez, y ninguna si el valor no cambia.
+// Añadir un dígito solo requiere añadir su fila a la tabla de pines.
+typedef struct {
+  int digits;
+  uint32_t all_mask[SEG_DISPLAY_BANKS];                              // Pines de todos los dígitos
+  uint32_t set_mask[SEG_DISPLAY_MAX_DIGITS][10][SEG_DISPLAY_BANKS];  // Pines a 1 por dígito y valor
+  uint32_t value;  // Último valor escrito
+  bool shown;
+  uint32_t skipped;  // Actualizaciones evitadas por no cambiar el valor
+} seg_display_t;
+
+// pins[0] es el dígito más significativo. Configura todos los pines como salida.
+esp_err_t seg_display_init(seg_display_t *disp, const gpio_num_t pins[][SEG_DISPLAY_BCD_WEIGHTS], int digits);
+
+// Muestra 'value' en decimal (se descartan las cifras que no caben).
+// Devuelve false si el valor ya estaba en pantalla y no se ha escrito nada.
+bool seg_display_show(seg_display_t *disp, uint32_t value);
@@ -0,0 +1,48 @@
+#pragma once
+#include <stdatomic.h>
+#include <stdint.h>
+#include "adc_accum.h"
+#include "sdkconfig.h"
+
+// Capacidad en muestras de cada buffer circular (potencia de 2)
+#define ADC_RING_CAPACITY CONFIG_ADC_RING_SAMPLES
+#define ADC_RING_MASK (ADC_RING_CAPACITY - 1)
+
+_Static_assert((ADC_RING_CAPACITY & ADC_RING_MASK) == 0, "CONFIG_ADC_RING_SAMPLES debe ser potencia de 2");
+
+// Máximo de muestras por llamada a adc_ring_push (una trama DMA de 256 bytes).
+// El productor copia los datos antes de publicar head, así que un push en
+// curso puede estar pisando este número de muestras más antiguas: el
+// consumidor nunca lee más de ADC_RING_MAX_READ.
+#define ADC_FRAME_SAMPLES 128
+#define ADC_RING_MAX_READ (ADC_RING_CAPACITY - ADC_FRAME_SAMPLES)
+
+// --- Buffer circular SPSC sin bloqueos ---
+// Un único productor (la tarea de adquisición) escribe y sobrescribe las
+// muestras más antiguas; el consumidor lee las N más recientes sin tomar
+// ningún mutex y reintenta si el productor le adelanta durante la lectura.
+typedef struct {
+  uint16_t data[ADC_RING_CAPACITY];
+  atomic_uint head;  // Total de muestras escritas (contador libre, solo lo avanza el productor)
+} adc_ring_t;
+
+void adc_ring_reset(adc_ring_t *ring);
+
+// Muestras escritas desde el último reset
+static inline uint32_t adc_ring_written(adc_ring_t *ring) {
+  return atomic_load_explicit(&ring->head, memory_order_acquire);
+}
+
+// --- Lado productor ---
+void adc_ring_push(adc_ring_t *ring, const uint16_t *samples, uint32_t count);
+
+// --- Lado consumidor ---
+// Acumula en acc[slot] las 'count' muestras más recientes (como mucho
+// ADC_RING_MAX_READ). Devuelve cuántas se han acumulado (puede ser menos si
+// el buffer aún no se ha llenado) o 0 si
+// el productor sobrescribió la ventana en todos los reintentos.
+uint32_t adc_ring_accumulate_recent(adc_ring_t *ring, uint32_t count, adc_accum_t *acc, int slot);
+
+// Copia en 'out' las 'count' muestras más recientes en orden cronológico.
+// Devuelve cuántas se han copiado, con el mismo criterio que la anterior.
+uint32_t adc_ring_copy_recent(adc_ring_t *ring, uint16_t *out, uint32_t count);
@@ -4,12 +4,22 @@
 #include "drivers/adc_driver.h"
 #include "sensors/ldr_sensor.h"
 #include "utils/math_utils.h"
+#include "utils/light_lut.h"
+#include "utils/deadband.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
 
 #define MQTT_BROKER "mqtts://192.168.1.89:1885"
 #define MQTT_TOKEN  "5oaq3wkp4wjarfsp90te"
+#define REPORT_INTERVAL_MS 5000
+#define MAX_SILENCE_MS (CONFIG_REPORT_MAX_SILENCE_S * 1000)
+
+// Filtros de publicación por métrica
+static deadband_t s_light_db = DEADBAND_INIT(CONFIG_REPORT_LIGHT_DELTA, 0.0f, MAX_SILENCE_MS);
+#if CONFIG_LDR_FLICKER
+static deadband_t s_flicker_db = DEADBAND_INIT(CONFIG_REPORT_FLICKER_DELTA, 0.0f, MAX_SILENCE_MS);
+#endif
 
 void app_main(void) {
   wifi_manager_init();
@@ -31,16 +41,65 @@ void app_main(void) {
   }
 
   ldr_init(adc_handle);
+#if CONFIG_LDR_LUT_BENCHMARK
+  ldr_benchmark_light_lut();
+#endif
+#if CONFIG_ADC_DECIM_BENCHMARK
+  adc_decim_benchmark(ADC_DRIVER_SAMPLE_FREQ_HZ / adc_driver_num_channels());
+#endif
+#if CONFIG_LDR_FLICKER_BENCHMARK
+  flicker_benchmark(ADC_DRIVER_SAMPLE_FREQ_HZ / adc_driver_num_channels());
+#endif
 
   while (true) {
-    float resistance = ldr_get_resistance(adc_handle);
-    if (resistance < 0) continue;
+    // Con CONFIG_ADC_ADAPTIVE captura aquí una ráfaga u oneshot; si no, no hace nada
+    adc_driver_power_t power;
+    adc_driver_capture(REPORT_INTERVAL_MS, &power);
+
+    int raw_value = ldr_get_raw(adc_handle);
+    if (raw_value < 0) {
+      // La lectura no bloquea: sin datos (arranque o tarea de adquisición
+      // parada) se espera una ventana en lugar de girar en vacío
+      vTaskDelay(pdMS_TO_TICKS(LDR_WINDOW_MS));
+      continue;
+    }
+
+    uint8_t light_level = light_level_from_raw(raw_value);
+    bool light_changed = deadband_update(&s_light_db, light_level);
+#if CONFIG_LDR_FLICKER
+    flicker_result_t flicker;
+    if (ldr_get_flicker(&flicker) == ESP_OK) {
+      bool flicker_changed = deadband_update(&s_flicker_db, flicker.percent);
+      if (light_changed || flicker_changed) {
+        // El mensaje lleva las dos métricas: ambas pasan a ser la referencia
+        // de su banda, o la que no cambió seguiría comparándose con un valor
+        // anterior al que ya se ha publicado
+        deadband_commit(&s_light_db, light_level);
+        deadband_commit(&s_flicker_db, flicker.percent);
+        mqtt_manager_publish_light_flicker(light_level, flicker.percent, flicker.index, flicker.dominant_hz);
+      }
+    } else if (light_changed) {
+      mqtt_manager_publish_light(light_level);
+    }
+#else
+    if (light_changed) {
+      mqtt_manager_publish_light(light_level);
+    }
+#endif
+    if (!light_changed) {
+      ESP_LOGI("MAIN", "Luz sin cambios (%lu publicaciones evitadas)", s_light_db.suppressed);
+    }
 
-    uint8_t light_level = calculate_light_level(resistance);
-    mqtt_manager_publish_light(light_level);
+    ESP_LOGI("MAIN", "Raw: %d, Resistencia: %.2f Ω, Luz: %d%%", raw_value, ldr_raw_to_resistance(raw_value), light_level);
 
-    ESP_LOGI("MAIN", "Resistencia: %.2f Ω, Luz: %d%%", resistance, light_level);
-    vTaskDelay(pdMS_TO_TICKS(5000));
+    adc_driver_stats_t stats;
+    adc_driver_get_stats(&stats);
+    ESP_LOGI("MAIN", "ADC: tramas=%lu muestras=%lu descartadas=%lu desbordes=%lu errores=%lu",
+             stats.frames, stats.samples, stats.dropped, stats.overflows, stats.read_errors);
+    ESP_LOGI("MAIN", "ADC %s: %lu Hz, ventana %lu ms, %lu muestras, ciclo de trabajo %.3f%%, %lu nJ/muestra",
+             adc_driver_mode_name(power.mode), power.sample_freq_hz, power.window_ms, power.samples,
+             power.duty_cycle * 100.0f, power.energy_per_sample_nj);
+    vTaskDelay(pdMS_TO_TICKS(REPORT_INTERVAL_MS));
   }
 }
 
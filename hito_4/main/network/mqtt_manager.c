@@ -28,3 +28,17 @@ void mqtt_manager_publish_light(uint8_t light_level) {
   ESP_LOGI(TAG, "Publicado nivel de luz: %d%%", light_level);
 }
 
+void mqtt_manager_publish_light_flicker(uint8_t light_level, float flicker_percent, float flicker_index, float flicker_hz) {
+  if (!client) {
+    ESP_LOGW(TAG, "Cliente MQTT no inicializado");
+    return;
+  }
+
+  char payload[128];
+  snprintf(payload, sizeof(payload),
+           "{\"light\": %d, \"flicker_percent\": %.1f, \"flicker_index\": %.3f, \"flicker_hz\": %.1f}",
+           light_level, flicker_percent, flicker_index, flicker_hz);
+  esp_mqtt_client_publish(client, "v1/devices/me/telemetry", payload, 0, 1, 0);
+  ESP_LOGI(TAG, "Publicado nivel de luz: %d%%, parpadeo %.1f%% a %.1f Hz", light_level, flicker_percent, flicker_hz);
+}
+
@@ -5,6 +5,7 @@
 
 void mqtt_manager_init(const char *broker_url, const char *token);
 void mqtt_manager_publish_light(uint8_t light_level);
+void mqtt_manager_publish_light_flicker(uint8_t light_level, float flicker_percent, float flicker_index, float flicker_hz);
 
 #endif
 
@@ -3,9 +3,35 @@
 
 #include "esp_adc/adc_continuous.h"
 #include "drivers/adc_driver.h"
+#include "sdkconfig.h"
+#include "utils/flicker.h"
+
+#define LDR_WINDOW_MS 200  // Ventana de promediado sobre las muestras más recientes
 
 void ldr_init(adc_continuous_handle_t handle);
+
+// Muestras nuevas que necesita una lectura tras arrancar el ADC (ventana de
+// promediado y, con CONFIG_LDR_FLICKER, bloque de la FFT), en ms
+uint32_t ldr_settle_ms(void);
+
+// Código ADC filtrado por el decimador CIC+FIR (media de la captura con
+// CONFIG_ADC_ADAPTIVE), -1 si no hay datos
+int ldr_get_raw(adc_continuous_handle_t handle);
+float ldr_raw_to_resistance(uint16_t raw_value);
 float ldr_get_resistance(adc_continuous_handle_t handle);
 
+// Nivel de luz por tabla precalculada sobre la tensión calibrada (sin coma
+// flotante), -1 si no hay datos
+int ldr_get_light_level(adc_continuous_handle_t handle);
+
+#if CONFIG_LDR_FLICKER
+// Análisis de parpadeo del último bloque de muestras crudas. Se ejecuta en la
+// tarea que llama, sin bloquear a la de adquisición.
+esp_err_t ldr_get_flicker(flicker_result_t *out);
 #endif
 
+#if CONFIG_LDR_LUT_BENCHMARK
+void ldr_benchmark_light_lut(void);
+#endif
+
+#endif
@@ -0,0 +1,167 @@
+#include "flicker.h"
+
+#if CONFIG_LDR_FLICKER
+#include <math.h>
+#include <stdbool.h>
+
+#define HALF_SIZE (FLICKER_FFT_SIZE / 2)  // Puntos de la FFT compleja
+#define MIN_FREQ_HZ 20                    // Por debajo es variación de iluminación, no parpadeo
+#define SMOOTH_SAMPLES 4                  // Media móvil para que el ruido no infle máx/mín
+
+_Static_assert((FLICKER_FFT_SIZE & (FLICKER_FFT_SIZE - 1)) == 0, "El tamaño de la FFT debe ser potencia de 2");
+
+// Bloque real empaquetado como HALF_SIZE complejos intercalados (re, im)
+static float s_buf[FLICKER_FFT_SIZE];
+// e^{-2πik/N} = cos − i·sin para k < N/2; sirve a la FFT compleja (paso 2),
+// a la separación del espectro real y a la ventana de Hann
+static float s_cos[HALF_SIZE];
+static float s_sin[HALF_SIZE];
+static bool s_tables_ready = false;
+
+static void flicker_init_tables(void) {
+  for (int k = 0; k < HALF_SIZE; k++) {
+    float angle = 2.0f * (float)M_PI * k / FLICKER_FFT_SIZE;
+    s_cos[k] = cosf(angle);
+    s_sin[k] = sinf(angle);
+  }
+  s_tables_ready = true;
+}
+
+// FFT compleja radix-2 in situ (decimación en el tiempo) de HALF_SIZE puntos
+static void flicker_fft_complex(float *data) {
+  for (uint32_t i = 1, j = 0; i < HALF_SIZE; i++) {
+    uint32_t bit = HALF_SIZE >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      float tr = data[2 * i], ti = data[2 * i + 1];
+      data[2 * i] = data[2 * j];
+      data[2 * i + 1] = data[2 * j + 1];
+      data[2 * j] = tr;
+      data[2 * j + 1] = ti;
+    }
+  }
+
+  for (uint32_t len = 2; len <= HALF_SIZE; len <<= 1) {
+    const uint32_t half = len >> 1;
+    const uint32_t stride = FLICKER_FFT_SIZE / len;
+    for (uint32_t j = 0; j < half; j++) {
+      const float wr = s_cos[j * stride];
+      const float wi = -s_sin[j * stride];
+      for (uint32_t i = j; i < HALF_SIZE; i += len) {
+        float *a = &data[2 * i];
+        float *b = &data[2 * (i + half)];
+        float tr = b[0] * wr - b[1] * wi;
+        float ti = b[0] * wi + b[1] * wr;
+        b[0] = a[0] - tr;
+        b[1] = a[1] - ti;
+        a[0] += tr;
+        a[1] += ti;
+      }
+    }
+  }
+}
+
+// |X[k]|² del espectro real a partir de la FFT compleja empaquetada, 0 < k < N/2
+static float flicker_bin_power(const float *z, uint32_t k) {
+  const float zr = z[2 * k], zi = z[2 * k + 1];
+  const float mr = z[2 * (HALF_SIZE - k)], mi = z[2 * (HALF_SIZE - k) + 1];
+  const float ar = zr + mr, ai = zi - mi;
+  const float br = zr - mr, bi = zi + mi;
+  const float c = s_cos[k], s = s_sin[k];
+  const float xr = 0.5f * (ar + c * bi - s * br);
+  const float xi = 0.5f * (ai - c * br - s * bi);
+  return xr * xr + xi * xi;
+}
+
+void flicker_analyze(const uint16_t *samples, uint32_t sample_rate_hz, flicker_result_t *out) {
+  if (!s_tables_ready) flicker_init_tables();
+
+  // --- Dominio del tiempo: media, porcentaje e índice de parpadeo ---
+  uint32_t sum = 0;
+  for (int n = 0; n < FLICKER_FFT_SIZE; n++) sum += samples[n];
+  const float mean = (float)sum / FLICKER_FFT_SIZE;
+
+  uint32_t window = 0, win_max = 0, win_min = UINT32_MAX;
+  float above = 0.0f;
+  for (int n = 0; n < FLICKER_FFT_SIZE; n++) {
+    window += samples[n];
+    if (n >= SMOOTH_SAMPLES) window -= samples[n - SMOOTH_SAMPLES];
+    if (n >= SMOOTH_SAMPLES - 1) {
+      if (window > win_max) win_max = window;
+      if (window < win_min) win_min = window;
+    }
+    float diff = samples[n] - mean;
+    if (diff > 0.0f) above += diff;
+  }
+
+  out->percent = (win_max + win_min) ? 100.0f * (win_max - win_min) / (win_max + win_min) : 0.0f;
+  out->index = sum ? above / sum : 0.0f;
+
+  // --- Dominio de la frecuencia: ventana de Hann sin continua y FFT real ---
+  // Para n >= N/2: cos(2πn/N) = −cos(2π(n − N/2)/N)
+  for (int n = 0; n < HALF_SIZE; n++) {
+    s_buf[n] = (samples[n] - mean) * (0.5f - 0.5f * s_cos[n]);
+    s_buf[n + HALF_SIZE] = (samples[n + HALF_SIZE] - mean) * (0.5f + 0.5f * s_cos[n]);
+  }
+  flicker_fft_complex(s_buf);
+
+  uint32_t k_min = (MIN_FREQ_HZ * FLICKER_FFT_SIZE) / sample_rate_hz;
+  if (k_min < 2) k_min = 2;  // Lóbulo principal de Hann alrededor de DC
+
+  uint32_t peak = k_min;
+  float peak_power = 0.0f;
+  for (uint32_t k = k_min; k < HALF_SIZE; k++) {
+    float power = flicker_bin_power(s_buf, k);
+    if (power > peak_power) {
+      peak_power = power;
+      peak = k;
+    }
+  }
+
+  // Interpolación parabólica sobre la magnitud de los bins vecinos
+  float delta = 0.0f;
+  if (peak > k_min && peak + 1 < HALF_SIZE) {
+    float a = sqrtf(flicker_bin_power(s_buf, peak - 1));
+    float b = sqrtf(peak_power);
+    float c = sqrtf(flicker_bin_power(s_buf, peak + 1));
+    float denom = a - 2.0f * b + c;
+    if (denom != 0.0f) delta = 0.5f * (a - c) / denom;
+  }
+
+  out->dominant_hz = (peak_power > 0.0f) ? (peak + delta) * sample_rate_hz / FLICKER_FFT_SIZE : 0.0f;
+}
+
+#if CONFIG_LDR_FLICKER_BENCHMARK
+#include "esp_cpu.h"
+#include "esp_log.h"
+
+#define TAG "FLICKER"
+#define BENCH_FREQ_HZ 100
+#define BENCH_ROUNDS 8
+
+void flicker_benchmark(uint32_t sample_rate_hz) {
+  static uint16_t block[FLICKER_FFT_SIZE];
+
+  // Parpadeo senoidal de 100 Hz con modulación del 30 % sobre 2000 LSB
+  for (int n = 0; n < FLICKER_FFT_SIZE; n++) {
+    float phase = 2.0f * (float)M_PI * BENCH_FREQ_HZ * n / sample_rate_hz;
+    block[n] = (uint16_t)(2000.0f + 600.0f * sinf(phase));
+  }
+
+  flicker_result_t result;
+  flicker_analyze(block, sample_rate_hz, &result);  // Inicializa las tablas fuera de la medida
+
+  uint32_t start = esp_cpu_get_cycle_count();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    flicker_analyze(block, sample_rate_hz, &result);
+  }
+  uint32_t cycles = (esp_cpu_get_cycle_count() - start) / BENCH_ROUNDS;
+
+  ESP_LOGI(TAG, "Benchmark FFT %d: %lu ciclos (%lu us) por bloque; %.1f %%, índice %.3f, %.1f Hz",
+           FLICKER_FFT_SIZE, cycles, cycles / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+           result.percent, result.index, result.dominant_hz);
+}
+#endif
+
+#endif
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Genera la tabla tensión calibrada (mV) -> nivel de luz.
+
+Reproduce el cálculo en coma flotante de ldr_sensor.c + math_utils.c para
+cada tensión de 0 a 4095 mV. La tabla se indexa con la salida de
+adc_calib_raw_to_mv(), así que cada lectura pasa por la calibración de eFuse
+del chip y la conversión se reduce a dos accesos a memoria. Lo invoca CMake
+con los valores de calibración de Kconfig; cambiar la calibración regenera la
+tabla.
+"""
+
+import argparse
+import math
+
+LUT_SIZE = 4096  # mV
+VCC = 3.3
+
+
+def light_level(mv, fixed_resistor, r_dark, r_light, max_level):
+    if mv == 0:
+        # Resistencia nula: máxima luz
+        return max_level
+
+    v_adc = mv / 1000.0
+    if v_adc >= VCC:
+        v_adc = VCC - 0.001
+    resistance = fixed_resistor * (v_adc / (VCC - v_adc))
+
+    level = 100.0 * (math.log10(r_dark / resistance) / math.log10(r_dark / r_light))
+    level = min(max(level, 0.0), float(max_level))
+    # roundf() redondea los .5 alejándose de cero
+    return int(math.floor(level + 0.5))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--fixed-resistor", type=float, required=True)
+    parser.add_argument("--r-dark", type=float, required=True)
+    parser.add_argument("--r-light", type=float, required=True)
+    parser.add_argument("--max-level", type=int, default=100)
+    parser.add_argument("--output", required=True)
+    args = parser.parse_args()
+
+    table = [light_level(mv, args.fixed_resistor, args.r_dark, args.r_light, args.max_level)
+             for mv in range(LUT_SIZE)]
+
+    lines = [
+        "// Archivo generado por gen_light_lut.py. No editar.",
+        "// FIXED_RESISTOR=%g R_DARK=%g R_LIGHT=%g MAX_LEVEL=%d"
+        % (args.fixed_resistor, args.r_dark, args.r_light, args.max_level),
+        '#include "light_lut.h"',
+        "",
+        "const uint8_t light_lut[LIGHT_LUT_SIZE] = {",
+    ]
+    for i in range(0, LUT_SIZE, 16):
+        lines.append("  " + ", ".join("%3d" % v for v in table[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,9 +1,10 @@
 #include "math_utils.h"
+#include "sdkconfig.h"
 #include <math.h>
 
 uint8_t calculate_light_level(float resistance) {
-  const float R_DARK = 100000.0f;
-  const float R_LIGHT = 1000.0f;
+  const float R_DARK = (float)CONFIG_LDR_R_DARK;
+  const float R_LIGHT = (float)CONFIG_LDR_R_LIGHT;
 
   float level = 100.0f * (log10f(R_DARK / resistance) / log10f(R_DARK / R_LIGHT));
 
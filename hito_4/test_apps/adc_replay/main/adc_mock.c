@@ -0,0 +1,172 @@
+#include "adc_mock.h"
+#include "esp_adc/adc_cali.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MOCK_MAX_POOL_FRAMES 16
+#define MOCK_READ_POLL_TICKS 1  // pdMS_TO_TICKS(1) es 0 con el tick de 100 Hz
+
+// Pool de tramas convertidas pendientes de adc_continuous_read, como el
+// ringbuffer de max_store_buf_size bytes del driver de IDF
+struct adc_continuous_ctx_t {
+  uint32_t frame_size;
+  uint32_t pool_frames;
+  uint8_t *pool;
+  uint32_t pool_len[MOCK_MAX_POOL_FRAMES];
+  uint32_t pool_head;   // Siguiente trama a leer
+  uint32_t pool_count;  // Tramas pendientes
+  bool started;
+  adc_continuous_evt_cbs_t cbs;
+  void *user_data;
+};
+
+static struct adc_continuous_ctx_t *s_ctx = NULL;
+static portMUX_TYPE s_pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *hdl_config, adc_continuous_handle_t *ret_handle) {
+  if (s_ctx != NULL) return ESP_ERR_INVALID_STATE;  // Un solo ADC digital, como en el chip
+  if (hdl_config->conv_frame_size == 0 || hdl_config->conv_frame_size % SOC_ADC_DIGI_RESULT_BYTES != 0) {
+    return ESP_ERR_INVALID_ARG;
+  }
+
+  uint32_t pool_frames = hdl_config->max_store_buf_size / hdl_config->conv_frame_size;
+  if (pool_frames == 0 || pool_frames > MOCK_MAX_POOL_FRAMES) return ESP_ERR_INVALID_ARG;
+
+  struct adc_continuous_ctx_t *ctx = calloc(1, sizeof(*ctx));
+  if (ctx == NULL) return ESP_ERR_NO_MEM;
+  ctx->pool = malloc(pool_frames * hdl_config->conv_frame_size);
+  if (ctx->pool == NULL) {
+    free(ctx);
+    return ESP_ERR_NO_MEM;
+  }
+  ctx->frame_size = hdl_config->conv_frame_size;
+  ctx->pool_frames = pool_frames;
+
+  s_ctx = ctx;
+  *ret_handle = ctx;
+  return ESP_OK;
+}
+
+esp_err_t adc_continuous_config(adc_continuous_handle_t handle, const adc_continuous_config_t *config) {
+  if (handle->started) return ESP_ERR_INVALID_STATE;
+  if (config->sample_freq_hz < SOC_ADC_SAMPLE_FREQ_THRES_LOW || config->sample_freq_hz > SOC_ADC_SAMPLE_FREQ_THRES_HIGH) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  if (config->format != ADC_DIGI_OUTPUT_FORMAT_TYPE1) return ESP_ERR_NOT_SUPPORTED;
+  return ESP_OK;
+}
+
+esp_err_t adc_continuous_register_event_callbacks(adc_continuous_handle_t handle, const adc_continuous_evt_cbs_t *cbs, void *user_data) {
+  if (handle->started) return ESP_ERR_INVALID_STATE;
+  handle->cbs = *cbs;
+  handle->user_data = user_data;
+  return ESP_OK;
+}
+
+esp_err_t adc_continuous_start(adc_continuous_handle_t handle) {
+  if (handle->started) return ESP_ERR_INVALID_STATE;
+  handle->started = true;
+  return ESP_OK;
+}
+
+esp_err_t adc_continuous_stop(adc_continuous_handle_t handle) {
+  if (!handle->started) return ESP_ERR_INVALID_STATE;
+  handle->started = false;
+  return ESP_OK;
+}
+
+esp_err_t adc_continuous_read(adc_continuous_handle_t handle, uint8_t *buf, uint32_t length_max, uint32_t *out_length, uint32_t timeout_ms) {
+  if (!handle->started) return ESP_ERR_INVALID_STATE;
+
+  // Espera por sondeo: el mock no tiene un semáforo por trama como el ringbuffer de IDF
+  TickType_t start = xTaskGetTickCount();
+  while (true) {
+    portENTER_CRITICAL(&s_pool_lock);
+    if (handle->pool_count > 0) {
+      uint32_t slot = handle->pool_head;
+      uint32_t len = handle->pool_len[slot];
+      if (len > length_max) len = length_max;
+      memcpy(buf, handle->pool + slot * handle->frame_size, len);
+      handle->pool_head = (slot + 1) % handle->pool_frames;
+      handle->pool_count--;
+      portEXIT_CRITICAL(&s_pool_lock);
+      *out_length = len;
+      return ESP_OK;
+    }
+    portEXIT_CRITICAL(&s_pool_lock);
+
+    if (xTaskGetTickCount() - start >= pdMS_TO_TICKS(timeout_ms)) return ESP_ERR_TIMEOUT;
+    vTaskDelay(MOCK_READ_POLL_TICKS);
+  }
+}
+
+esp_err_t adc_continuous_flush_pool(adc_continuous_handle_t handle) {
+  portENTER_CRITICAL(&s_pool_lock);
+  handle->pool_head = 0;
+  handle->pool_count = 0;
+  portEXIT_CRITICAL(&s_pool_lock);
+  return ESP_OK;
+}
+
+esp_err_t adc_continuous_deinit(adc_continuous_handle_t handle) {
+  if (handle->started) return ESP_ERR_INVALID_STATE;
+  free(handle->pool);
+  free(handle);
+  s_ctx = NULL;
+  return ESP_OK;
+}
+
+esp_err_t adc_cali_raw_to_voltage(adc_cali_handle_t handle, int raw, int *voltage) {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t adc_mock_push_frame(const uint8_t *frame, uint32_t len) {
+  struct adc_continuous_ctx_t *ctx = s_ctx;
+  if (ctx == NULL || !ctx->started) return ESP_ERR_INVALID_STATE;
+  if (len == 0 || len > ctx->frame_size) return ESP_ERR_INVALID_ARG;
+
+  adc_continuous_evt_data_t edata = {
+    .size = len,
+  };
+  adc_continuous_callback_t cb;
+
+  portENTER_CRITICAL(&s_pool_lock);
+  bool stored = ctx->pool_count < ctx->pool_frames;
+  if (stored) {
+    uint32_t slot = (ctx->pool_head + ctx->pool_count) % ctx->pool_frames;
+    memcpy(ctx->pool + slot * ctx->frame_size, frame, len);
+    ctx->pool_len[slot] = len;
+    ctx->pool_count++;
+    edata.conv_frame_buffer = ctx->pool + slot * ctx->frame_size;
+    cb = ctx->cbs.on_conv_done;
+  } else {
+    // Igual que el DMA de IDF: sin hueco en el pool la trama se pierde
+    edata.conv_frame_buffer = (uint8_t *)frame;
+    cb = ctx->cbs.on_pool_ovf;
+  }
+  portEXIT_CRITICAL(&s_pool_lock);
+
+  if (cb != NULL && cb(ctx, &edata, ctx->user_data)) {
+    taskYIELD();
+  }
+  return stored ? ESP_OK : ESP_FAIL;
+}
+
+uint32_t adc_mock_replay(const uint8_t *recording, uint32_t len, uint32_t period_ms) {
+  if (s_ctx == NULL) return 0;
+
+  uint32_t stored = 0;
+  for (uint32_t off = 0; off < len; off += s_ctx->frame_size) {
+    uint32_t chunk = len - off;
+    if (chunk > s_ctx->frame_size) chunk = s_ctx->frame_size;
+    if (adc_mock_push_frame(recording + off, chunk) == ESP_OK) stored++;
+    if (period_ms > 0) vTaskDelay(pdMS_TO_TICKS(period_ms));
+  }
+  return stored;
+}
+
+uint32_t adc_mock_pool_frames(void) {
+  return (s_ctx != NULL) ? s_ctx->pool_frames : 0;
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "esp_adc/adc_continuous.h"
+
+// --- Fuente de tramas para el mock de adc_continuous ---
+// Sustituye al DMA: cada trama inyectada pasa por el mismo camino que en el
+// chip. Con el ADC arrancado entra en el pool y dispara on_conv_done; con el
+// pool lleno se pierde y dispara on_pool_ovf. Con el ADC parado se ignora.
+// Los callbacks se ejecutan en el contexto de quien inyecta, como una ISR.
+
+// Inyecta una trama TYPE1 (len <= conv_frame_size). Devuelve ESP_OK si entró
+// en el pool, ESP_FAIL si se perdió por desbordamiento y ESP_ERR_INVALID_STATE
+// si el ADC estaba parado.
+esp_err_t adc_mock_push_frame(const uint8_t *frame, uint32_t len);
+
+// Reproduce una grabación de tramas DMA consecutivas (la salida cruda de
+// adc_continuous_read concatenada) en tramas de conv_frame_size bytes,
+// esperando period_ms entre tramas. Devuelve las que entraron en el pool.
+uint32_t adc_mock_replay(const uint8_t *recording, uint32_t len, uint32_t period_ms);
+
+// Tramas que caben en el pool (max_store_buf_size / conv_frame_size)
+uint32_t adc_mock_pool_frames(void);
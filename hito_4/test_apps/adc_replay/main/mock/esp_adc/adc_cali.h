@@ -0,0 +1,8 @@
+#pragma once
+// Subconjunto de esp_adc/adc_cali.h para el target linux: sin eFuse no hay
+// esquemas, así que adc_calib cae siempre en el modelo nominal
+#include "esp_adc/adc_continuous.h"
+
+typedef struct adc_cali_scheme_t *adc_cali_handle_t;
+
+esp_err_t adc_cali_raw_to_voltage(adc_cali_handle_t handle, int raw, int *voltage);
@@ -0,0 +1,3 @@
+#pragma once
+// Ni ADC_CALI_SCHEME_CURVE_FITTING_SUPPORTED ni ADC_CALI_SCHEME_LINE_FITTING_SUPPORTED
+#include "esp_adc/adc_cali.h"
@@ -0,0 +1,175 @@
+#include "adc_driver.h"
+#include "adc_mock.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAME_BYTES 256  // CONV_FRAME_SIZE del driver
+#define FRAME_SAMPLES (FRAME_BYTES / SOC_ADC_DIGI_RESULT_BYTES)
+#define RECORDING_FRAMES 4
+#define REPLAY_PERIOD_MS 10
+#define WAIT_TIMEOUT_MS 1000
+#define RESTART_WINDOW_MS 10
+#define FOREIGN_CHANNEL 5  // Fuera del patrón de sdkconfig.defaults
+
+#if CONFIG_ADC_ADAPTIVE
+#error "El test reproduce tramas del modo continuo: desactiva CONFIG_ADC_ADAPTIVE"
+#endif
+
+static adc_continuous_handle_t s_handle;
+
+// Palabra TYPE1: bits 0-11 dato, bits 12-15 canal
+static inline uint16_t type1(uint8_t channel, uint16_t data) {
+  return (uint16_t)((channel << 12) | (data & 0xFFF));
+}
+
+// Grabación de 'frames' tramas consecutivas del canal 0 con una rampa
+// que empieza en 'first'
+static uint8_t *record_ramp(uint32_t frames, uint16_t first) {
+  uint16_t *words = malloc(frames * FRAME_BYTES);
+  for (uint32_t i = 0; i < frames * FRAME_SAMPLES; i++) {
+    words[i] = type1(0, first + i);
+  }
+  return (uint8_t *)words;
+}
+
+static void record_constant(uint8_t *frame, uint8_t channel, uint16_t value) {
+  uint16_t *words = (uint16_t *)frame;
+  for (int i = 0; i < FRAME_SAMPLES; i++) {
+    words[i] = type1(channel, value);
+  }
+}
+
+// Espera a que la tarea de adquisición haya drenado 'frames' tramas
+static void wait_for_frames(uint32_t frames) {
+  adc_driver_stats_t stats;
+  for (int ms = 0; ms < WAIT_TIMEOUT_MS; ms += REPLAY_PERIOD_MS) {
+    adc_driver_get_stats(&stats);
+    if (stats.frames >= frames) return;
+    vTaskDelay(pdMS_TO_TICKS(REPLAY_PERIOD_MS));
+  }
+  adc_driver_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(frames, stats.frames);
+}
+
+static void test_replay_reaches_ring(void) {
+  adc_driver_stats_t before, after;
+  adc_driver_get_stats(&before);
+
+  uint8_t *recording = record_ramp(RECORDING_FRAMES, 0);
+  TEST_ASSERT_EQUAL_UINT32(RECORDING_FRAMES, adc_mock_replay(recording, RECORDING_FRAMES * FRAME_BYTES, REPLAY_PERIOD_MS));
+  wait_for_frames(before.frames + RECORDING_FRAMES);
+
+  adc_driver_get_stats(&after);
+  TEST_ASSERT_EQUAL_UINT32(RECORDING_FRAMES * FRAME_SAMPLES, after.samples - before.samples);
+  TEST_ASSERT_EQUAL_UINT32(0, after.dropped - before.dropped);
+  TEST_ASSERT_EQUAL_UINT32(0, after.overflows - before.overflows);
+  TEST_ASSERT_EQUAL_UINT32(0, after.read_errors - before.read_errors);
+
+  uint16_t recent[RECORDING_FRAMES * FRAME_SAMPLES];
+  TEST_ASSERT_EQUAL_UINT32(RECORDING_FRAMES * FRAME_SAMPLES, adc_driver_copy_recent(0, recent, RECORDING_FRAMES * FRAME_SAMPLES));
+  for (uint32_t i = 0; i < RECORDING_FRAMES * FRAME_SAMPLES; i++) {
+    TEST_ASSERT_EQUAL_UINT16(i, recent[i]);
+  }
+  free(recording);
+}
+
+static void test_foreign_channel_is_dropped(void) {
+  adc_driver_stats_t before, after;
+  adc_driver_get_stats(&before);
+
+  uint16_t frame[FRAME_SAMPLES];
+  for (int i = 0; i < FRAME_SAMPLES; i++) {
+    frame[i] = type1((i & 1) ? FOREIGN_CHANNEL : 0, 0x800);
+  }
+  TEST_ASSERT_EQUAL(ESP_OK, adc_mock_push_frame((const uint8_t *)frame, sizeof(frame)));
+  wait_for_frames(before.frames + 1);
+
+  adc_driver_get_stats(&after);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_SAMPLES / 2, after.samples - before.samples);
+  TEST_ASSERT_EQUAL_UINT32(FRAME_SAMPLES / 2, after.dropped - before.dropped);
+}
+
+// Con la tarea de adquisición sin CPU el pool se llena: cada trama de más
+// debe perderse y contarse como desbordamiento, y las del pool drenarse después
+static void test_pool_overflow_is_counted(void) {
+  const uint32_t pool = adc_mock_pool_frames();
+  const uint32_t extra = 3;
+  adc_driver_stats_t before, after;
+  adc_driver_get_stats(&before);
+
+  uint8_t frame[FRAME_BYTES];
+  record_constant(frame, 0, 0x400);
+
+  UBaseType_t priority = uxTaskPriorityGet(NULL);
+  vTaskPrioritySet(NULL, configMAX_PRIORITIES - 1);
+  for (uint32_t i = 0; i < pool + extra; i++) {
+    esp_err_t expected = (i < pool) ? ESP_OK : ESP_FAIL;
+    TEST_ASSERT_EQUAL(expected, adc_mock_push_frame(frame, sizeof(frame)));
+  }
+  vTaskPrioritySet(NULL, priority);
+  wait_for_frames(before.frames + pool);
+
+  adc_driver_get_stats(&after);
+  TEST_ASSERT_EQUAL_UINT32(pool, after.frames - before.frames);
+  TEST_ASSERT_EQUAL_UINT32(extra, after.overflows - before.overflows);
+  TEST_ASSERT_EQUAL_UINT32(pool * FRAME_SAMPLES, after.samples - before.samples);
+}
+
+static void feeder_task(void *arg) {
+  TaskHandle_t waiter = arg;
+  uint8_t *recording = malloc(RECORDING_FRAMES * FRAME_BYTES);
+  for (int f = 0; f < RECORDING_FRAMES; f++) {
+    record_constant(recording + f * FRAME_BYTES, 0, 0x222);
+  }
+  // Tras la llamada a adc_driver_start, que arranca el ADC sin esperar
+  vTaskDelay(pdMS_TO_TICKS(2 * REPLAY_PERIOD_MS));
+  adc_mock_replay(recording, RECORDING_FRAMES * FRAME_BYTES, REPLAY_PERIOD_MS);
+  free(recording);
+  xTaskNotifyGive(waiter);
+  vTaskDelete(NULL);
+}
+
+static void test_restart_discards_old_samples(void) {
+  uint8_t frame[FRAME_BYTES];
+  record_constant(frame, 0, 0x111);
+  adc_driver_stats_t stats;
+  adc_driver_get_stats(&stats);
+  TEST_ASSERT_EQUAL(ESP_OK, adc_mock_push_frame(frame, sizeof(frame)));
+  wait_for_frames(stats.frames + 1);
+
+  TEST_ASSERT_EQUAL(ESP_OK, adc_driver_stop());
+  TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, adc_mock_push_frame(frame, sizeof(frame)));
+
+  TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(feeder_task, "feeder", 4096, xTaskGetCurrentTaskHandle(), 5, NULL));
+  TEST_ASSERT_EQUAL(ESP_OK, adc_driver_start(RESTART_WINDOW_MS));
+
+  // La ventana pedida ya solo contiene muestras posteriores al arranque
+  const uint32_t wanted = RESTART_WINDOW_MS * (CONFIG_ADC_SAMPLE_FREQ_HZ / adc_driver_num_channels()) / 1000;
+  uint16_t *recent = malloc(wanted * sizeof(uint16_t));
+  TEST_ASSERT_EQUAL_UINT32(wanted, adc_driver_copy_recent(0, recent, wanted));
+  for (uint32_t i = 0; i < wanted; i++) {
+    TEST_ASSERT_EQUAL_HEX16(0x222, recent[i]);
+  }
+  free(recent);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+static void test_restart_times_out_without_samples(void) {
+  TEST_ASSERT_EQUAL(ESP_OK, adc_driver_stop());
+  TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, adc_driver_start(RESTART_WINDOW_MS));
+}
+
+void app_main(void) {
+  ESP_ERROR_CHECK(adc_driver_init(&s_handle));
+
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_reaches_ring);
+  RUN_TEST(test_foreign_channel_is_dropped);
+  RUN_TEST(test_pool_overflow_is_counted);
+  RUN_TEST(test_restart_discards_old_samples);
+  RUN_TEST(test_restart_times_out_without_samples);
+  exit(UNITY_END() == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <stdint.h>
+
+#define ADC_ACCUM_SLOTS 8  // Canales del ADC1
+
+// --- Acumuladores por canal en estructura de arrays ---
+// Cada campo es un array indexado por la posición del canal en el patrón de
+// conversión, de forma que el bucle de decodificación toca memoria contigua.
+// Las sumas son de 64 bits: el acumulador de intervalo del driver solo se
+// vacía al leerlo y una suma de 32 bits desborda tras 2^20 muestras de 4095
+// (~52 s a 20 kHz). count desborda tras 2^32 muestras (~2,5 días a 20 kHz).
+typedef struct {
+  uint32_t count[ADC_ACCUM_SLOTS];
+  uint64_t sum[ADC_ACCUM_SLOTS];
+  uint64_t sumsq[ADC_ACCUM_SLOTS];
+  uint16_t min[ADC_ACCUM_SLOTS];
+  uint16_t max[ADC_ACCUM_SLOTS];
+} adc_accum_t;
+
+static inline void adc_accum_reset(adc_accum_t *acc, int slot) {
+  acc->count[slot] = 0;
+  acc->sum[slot] = 0;
+  acc->sumsq[slot] = 0;
+  acc->min[slot] = UINT16_MAX;
+  acc->max[slot] = 0;
+}
+
+static inline void adc_accum_add(adc_accum_t *acc, int slot, uint16_t value) {
+  acc->count[slot]++;
+  acc->sum[slot] += value;
+  acc->sumsq[slot] += (uint32_t)value * value;
+  if (value < acc->min[slot]) acc->min[slot] = value;
+  if (value > acc->max[slot]) acc->max[slot] = value;
+}
+
+// Suma en 'dst' lo acumulado en 'src' para el mismo canal
+static inline void adc_accum_merge(adc_accum_t *dst, const adc_accum_t *src, int slot) {
+  dst->count[slot] += src->count[slot];
+  dst->sum[slot] += src->sum[slot];
+  dst->sumsq[slot] += src->sumsq[slot];
+  if (src->min[slot] < dst->min[slot]) dst->min[slot] = src->min[slot];
+  if (src->max[slot] > dst->max[slot]) dst->max[slot] = src->max[slot];
+}
@@ -0,0 +1,144 @@
+#include "adc_calib.h"
+#include "adc_driver.h"
+#include "esp_adc/adc_cali.h"
+#include "esp_adc/adc_cali_scheme.h"
+#include "esp_log.h"
+#include "nvs.h"
+#include <stdio.h>
+
+#define TAG "ADC_CALIB"
+#define CALIB_NAMESPACE "adc_cal"
+#define CALIB_VERSION 1
+#define NODE_SHIFT 4  // Un nodo cada 16 códigos
+#define NUM_NODES ((ADC_CALIB_TABLE_SIZE >> NODE_SHIFT) + 1)
+#define NOMINAL_FULL_SCALE_MV 3300
+
+// Tabla compacta que se guarda en NVS: los nodos bastan para reconstruir la
+// tabla completa por interpolación lineal (el último nodo es el código 4095)
+typedef struct {
+  uint16_t version;
+  uint16_t atten;
+  uint16_t nodes[NUM_NODES];
+} adc_calib_blob_t;
+
+uint16_t adc_calib_mv_table[ADC_CALIB_TABLE_SIZE];
+static bool s_calibrated = false;
+
+static inline uint32_t node_raw(int i) {
+  uint32_t raw = (uint32_t)i << NODE_SHIFT;
+  return (raw < ADC_CALIB_TABLE_SIZE) ? raw : ADC_CALIB_TABLE_SIZE - 1;
+}
+
+static void adc_calib_expand(const uint16_t *nodes) {
+  for (int i = 0; i < NUM_NODES - 1; i++) {
+    uint32_t r0 = node_raw(i), r1 = node_raw(i + 1);
+    int32_t v0 = nodes[i], v1 = nodes[i + 1];
+    for (uint32_t raw = r0; raw <= r1; raw++) {
+      int32_t span = r1 - r0;
+      adc_calib_mv_table[raw] = v0 + ((v1 - v0) * (int32_t)(raw - r0) + span / 2) / span;
+    }
+  }
+}
+
+static void adc_calib_fill_nominal(void) {
+  for (uint32_t raw = 0; raw < ADC_CALIB_TABLE_SIZE; raw++) {
+    adc_calib_mv_table[raw] = (raw * NOMINAL_FULL_SCALE_MV + (ADC_CALIB_TABLE_SIZE - 1) / 2) / (ADC_CALIB_TABLE_SIZE - 1);
+  }
+}
+
+static bool adc_calib_load(const char *key, adc_calib_blob_t *blob) {
+  nvs_handle_t nvs;
+  if (nvs_open(CALIB_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) return false;
+
+  size_t len = sizeof(*blob);
+  esp_err_t ret = nvs_get_blob(nvs, key, blob, &len);
+  nvs_close(nvs);
+
+  return ret == ESP_OK && len == sizeof(*blob) && blob->version == CALIB_VERSION && blob->atten == ADC_DRIVER_ATTEN;
+}
+
+static void adc_calib_store(const char *key, const adc_calib_blob_t *blob) {
+  nvs_handle_t nvs;
+  if (nvs_open(CALIB_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+    ESP_LOGW(TAG, "No se pudo abrir NVS; la calibración se repetirá en el próximo arranque");
+    return;
+  }
+  if (nvs_set_blob(nvs, key, blob, sizeof(*blob)) != ESP_OK || nvs_commit(nvs) != ESP_OK) {
+    ESP_LOGW(TAG, "No se pudo guardar la calibración en NVS");
+  }
+  nvs_close(nvs);
+}
+
+// Crea el esquema de calibración soportado por el chip (curve fitting en los
+// recientes, line fitting en el ESP32), muestrea los nodos y lo libera
+static esp_err_t adc_calib_measure(adc_calib_blob_t *blob) {
+  adc_cali_handle_t handle = NULL;
+  esp_err_t ret;
+
+#if ADC_CALI_SCHEME_CURVE_FITTING_SUPPORTED
+  adc_cali_curve_fitting_config_t cali_cfg = {
+    .unit_id = ADC_UNIT_1,
+    .atten = ADC_DRIVER_ATTEN,
+    .bitwidth = ADC_BITWIDTH_12,
+  };
+  ret = adc_cali_create_scheme_curve_fitting(&cali_cfg, &handle);
+#elif ADC_CALI_SCHEME_LINE_FITTING_SUPPORTED
+  adc_cali_line_fitting_config_t cali_cfg = {
+    .unit_id = ADC_UNIT_1,
+    .atten = ADC_DRIVER_ATTEN,
+    .bitwidth = ADC_BITWIDTH_12,
+  };
+  ret = adc_cali_create_scheme_line_fitting(&cali_cfg, &handle);
+#else
+  ret = ESP_ERR_NOT_SUPPORTED;
+#endif
+  if (ret != ESP_OK) return ret;
+
+  blob->version = CALIB_VERSION;
+  blob->atten = ADC_DRIVER_ATTEN;
+  for (int i = 0; i < NUM_NODES && ret == ESP_OK; i++) {
+    int mv = 0;
+    ret = adc_cali_raw_to_voltage(handle, node_raw(i), &mv);
+    blob->nodes[i] = (uint16_t)mv;
+  }
+
+#if ADC_CALI_SCHEME_CURVE_FITTING_SUPPORTED
+  adc_cali_delete_scheme_curve_fitting(handle);
+#elif ADC_CALI_SCHEME_LINE_FITTING_SUPPORTED
+  adc_cali_delete_scheme_line_fitting(handle);
+#endif
+  return ret;
+}
+
+esp_err_t adc_calib_init(void) {
+  static adc_calib_blob_t blob;
+  char key[16];
+  snprintf(key, sizeof(key), "atten%d", ADC_DRIVER_ATTEN);
+
+  // Arranque en caliente: basta con expandir los nodos guardados
+  if (adc_calib_load(key, &blob)) {
+    adc_calib_expand(blob.nodes);
+    s_calibrated = true;
+    ESP_LOGI(TAG, "Calibración cargada de NVS (%s)", key);
+    return ESP_OK;
+  }
+
+  esp_err_t ret = adc_calib_measure(&blob);
+  if (ret != ESP_OK) {
+    ESP_LOGW(TAG, "Sin calibración de fábrica (%s); se usa el modelo nominal", esp_err_to_name(ret));
+    adc_calib_fill_nominal();
+    s_calibrated = false;
+    return ret;
+  }
+
+  adc_calib_expand(blob.nodes);
+  adc_calib_store(key, &blob);
+  s_calibrated = true;
+  ESP_LOGI(TAG, "Calibración generada y guardada en NVS (%s): 0 -> %u mV, 4095 -> %u mV",
+           key, blob.nodes[0], blob.nodes[NUM_NODES - 1]);
+  return ESP_OK;
+}
+
+bool adc_calib_is_calibrated(void) {
+  return s_calibrated;
+}
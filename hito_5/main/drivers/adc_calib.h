@@ -0,0 +1,22 @@
+#pragma once
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ADC_CALIB_TABLE_SIZE 4096
+
+// Tabla código ADC -> mV de la atenuación configurada. Se expande en RAM a
+// partir de los nodos guardados en NVS (o del esquema adc_cali la primera vez)
+extern uint16_t adc_calib_mv_table[ADC_CALIB_TABLE_SIZE];
+
+// Carga la calibración de NVS; si no está o no corresponde a la atenuación
+// actual, la obtiene con adc_cali una sola vez y la guarda. Requiere NVS
+// inicializado. Sin calibración en eFuse deja el modelo lineal nominal.
+esp_err_t adc_calib_init(void);
+
+// true si la tabla procede de la calibración de fábrica (no del modelo nominal)
+bool adc_calib_is_calibrated(void);
+
+static inline uint16_t adc_calib_raw_to_mv(uint16_t raw) {
+  return adc_calib_mv_table[raw & (ADC_CALIB_TABLE_SIZE - 1)];
+}
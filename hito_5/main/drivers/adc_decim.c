@@ -0,0 +1,150 @@
+#include "adc_decim.h"
+#include "esp_log.h"
+#include <string.h>
+
+#define TAG "ADC_DECIM"
+#define FIR_HALF (ADC_DECIM_FIR_TAPS / 2)
+#define OUTPUT_MAX ((4095u << ADC_DECIM_FRAC_BITS) | ((1u << ADC_DECIM_FRAC_BITS) - 1))
+
+// Compensador de sinc^3 en Q15, fase lineal (simétrico), ganancia DC = 1.
+// Diseño por mínimos cuadrados sobre la tasa del CIC (fs): banda de paso
+// 0-0.2 fs con la inversa de sinc^3, banda eliminada 0.3-0.5 fs con peso 10.
+// Conjunto CIC+FIR: rizado < 0.7 dB en paso, > 45 dB de atenuación.
+static const int16_t fir_coeffs[ADC_DECIM_FIR_TAPS] = {
+  245, 336, -383, -892, 488, 1888, -457, -3932, -269, 10782, 17156,
+  10782, -269, -3932, -457, 1888, 488, -892, -383, 336, 245,
+};
+
+void adc_decim_init(adc_decim_t *decim, uint32_t input_rate_hz) {
+  memset(decim, 0, sizeof(*decim));
+
+  uint32_t ratio = (input_rate_hz + CONFIG_ADC_DECIM_CIC_RATE_HZ / 2) / CONFIG_ADC_DECIM_CIC_RATE_HZ;
+  if (ratio == 0) ratio = 1;
+  decim->ratio = ratio;
+
+  // Con un factor redondeado los ceros del CIC se apartan de la red
+  if (input_rate_hz % CONFIG_ADC_DECIM_CIC_RATE_HZ != 0) {
+    uint32_t null_mhz = (uint32_t)(((uint64_t)input_rate_hz * 1000) / ratio);
+    ESP_LOGW(TAG, "%lu Hz por canal no es múltiplo de %d Hz: R=%lu deja los ceros del CIC en %lu.%03lu Hz",
+             input_rate_hz, CONFIG_ADC_DECIM_CIC_RATE_HZ, ratio, null_mhz / 1000, null_mhz % 1000);
+  }
+
+  decim->gain = 1;
+  for (int s = 0; s < ADC_DECIM_CIC_ORDER; s++) {
+    decim->gain *= ratio;
+  }
+}
+
+uint32_t adc_decim_output_rate_mhz(const adc_decim_t *decim, uint32_t input_rate_hz) {
+  return (uint32_t)(((uint64_t)input_rate_hz * 1000) / (decim->ratio * ADC_DECIM_FIR_FACTOR));
+}
+
+// Una salida del CIC: etapas peine y normalización a Q12.4 sin perder la
+// parte fraccionaria (el cociente entero y el resto se escalan por separado)
+static uint16_t adc_decim_comb(adc_decim_t *decim) {
+  uint64_t value = decim->integ[ADC_DECIM_CIC_ORDER - 1];
+  for (int s = 0; s < ADC_DECIM_CIC_ORDER; s++) {
+    uint64_t delayed = decim->comb[s];
+    decim->comb[s] = value;
+    value -= delayed;
+  }
+
+  uint64_t whole = value / decim->gain;
+  uint64_t frac = ((value % decim->gain) << ADC_DECIM_FRAC_BITS) / decim->gain;
+  uint64_t scaled = (whole << ADC_DECIM_FRAC_BITS) | frac;
+  return (scaled > OUTPUT_MAX) ? OUTPUT_MAX : (uint16_t)scaled;
+}
+
+// Mete una salida del CIC en el FIR; cada ADC_DECIM_FIR_FACTOR entradas
+// calcula una salida aprovechando la simetría de los coeficientes
+static bool adc_decim_fir(adc_decim_t *decim, uint16_t value) {
+  uint32_t pos = decim->fir_pos;
+  decim->fir_hist[pos] = value;
+  decim->fir_hist[pos + ADC_DECIM_FIR_TAPS] = value;
+  decim->fir_pos = (pos + 1 == ADC_DECIM_FIR_TAPS) ? 0 : pos + 1;
+
+  if (decim->fir_fill < ADC_DECIM_FIR_TAPS) decim->fir_fill++;
+  if (++decim->fir_phase < ADC_DECIM_FIR_FACTOR) return false;
+  decim->fir_phase = 0;
+  if (decim->fir_fill < ADC_DECIM_FIR_TAPS) return false;
+
+  // Ventana contigua con la muestra más antigua en window[0]
+  const uint16_t *window = &decim->fir_hist[decim->fir_pos];
+  int64_t acc = (int64_t)fir_coeffs[FIR_HALF] * window[FIR_HALF];
+  for (int k = 0; k < FIR_HALF; k++) {
+    acc += (int32_t)fir_coeffs[k] * ((int32_t)window[k] + window[ADC_DECIM_FIR_TAPS - 1 - k]);
+  }
+
+  int64_t out = (acc + (1 << 14)) >> 15;
+  if (out < 0) out = 0;
+  if (out > OUTPUT_MAX) out = OUTPUT_MAX;
+  decim->output = (uint16_t)out;
+  decim->ready = true;
+  return true;
+}
+
+uint32_t adc_decim_process(adc_decim_t *decim, const uint16_t *samples, uint32_t count) {
+  uint32_t produced = 0;
+
+  while (count > 0) {
+    // Tramo hasta la siguiente salida del CIC: solo integradores en registros
+    uint32_t run = decim->ratio - decim->phase;
+    if (run > count) run = count;
+
+    uint64_t i0 = decim->integ[0];
+    uint64_t i1 = decim->integ[1];
+    uint64_t i2 = decim->integ[2];
+    for (uint32_t i = 0; i < run; i++) {
+      i0 += samples[i];
+      i1 += i0;
+      i2 += i1;
+    }
+    decim->integ[0] = i0;
+    decim->integ[1] = i1;
+    decim->integ[2] = i2;
+
+    samples += run;
+    count -= run;
+    decim->phase += run;
+
+    if (decim->phase == decim->ratio) {
+      decim->phase = 0;
+      if (adc_decim_fir(decim, adc_decim_comb(decim))) produced++;
+    }
+  }
+
+  return produced;
+}
+
+#if CONFIG_ADC_DECIM_BENCHMARK
+#include "esp_cpu.h"
+
+#define BENCH_SAMPLES 4096
+#define BENCH_ROUNDS 16
+
+void adc_decim_benchmark(uint32_t input_rate_hz) {
+  static uint16_t block[BENCH_SAMPLES];
+  static adc_decim_t decim;
+
+  // Señal de prueba: rampa con ruido pseudoaleatorio
+  uint32_t lcg = 1;
+  for (int i = 0; i < BENCH_SAMPLES; i++) {
+    lcg = lcg * 1664525u + 1013904223u;
+    block[i] = (uint16_t)((i & 0x7FF) + (lcg >> 22)) & 0xFFF;
+  }
+
+  adc_decim_init(&decim, input_rate_hz);
+  uint32_t outputs = 0;
+
+  uint32_t start = esp_cpu_get_cycle_count();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    outputs += adc_decim_process(&decim, block, BENCH_SAMPLES);
+  }
+  uint32_t cycles = esp_cpu_get_cycle_count() - start;
+
+  uint32_t total = BENCH_SAMPLES * BENCH_ROUNDS;
+  uint64_t rate = ((uint64_t)total * CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000) / cycles;
+  ESP_LOGI(TAG, "Benchmark decimador: %lu muestras en %lu ciclos (%lu.%02lu ciclos/muestra), %llu muestras/s, %lu salidas",
+           total, cycles, cycles / total, (cycles % total) * 100 / total, rate, outputs);
+}
+#endif
@@ -1,12 +1,98 @@
 #pragma once
 #include "esp_adc/adc_continuous.h"
 #include "esp_err.h"
+#include "sdkconfig.h"
+#include "adc_decim.h"
 #include <stdint.h>
 
+#define ADC_DRIVER_SAMPLE_FREQ_HZ CONFIG_ADC_SAMPLE_FREQ_HZ
+#define ADC_DRIVER_DEFAULT_WINDOW_MS 100
+#define ADC_DRIVER_MAX_CHANNELS 8  // Canales del ADC1
+
+#if CONFIG_ADC_ATTEN_0DB
+#define ADC_DRIVER_ATTEN ADC_ATTEN_DB_0
+#elif CONFIG_ADC_ATTEN_2_5DB
+#define ADC_DRIVER_ATTEN ADC_ATTEN_DB_2_5
+#elif CONFIG_ADC_ATTEN_6DB
+#define ADC_DRIVER_ATTEN ADC_ATTEN_DB_6
+#else
+#define ADC_DRIVER_ATTEN ADC_ATTEN_DB_12
+#endif
+
 typedef struct {
   uint8_t channel;
   uint16_t average;
+  uint16_t min;
+  uint16_t max;
+  uint32_t variance;  // LSB²
+  uint16_t filtered;  // Última salida del decimador CIC+FIR en Q12.4 (ADC_DECIM_FRAC_BITS);
+                      // con CONFIG_ADC_ADAPTIVE, la media de la ventana en Q12.4
+  uint32_t samples;
 } adc_channel_result_t;
 
+// --- Contadores de la tarea de adquisición ---
+typedef struct {
+  uint32_t frames;       // Tramas DMA drenadas
+  uint32_t samples;      // Muestras guardadas en los buffers circulares
+  uint32_t dropped;      // Muestras descartadas (canal fuera de la tabla)
+  uint32_t overflows;    // Desbordamientos del pool DMA (datos perdidos antes de llegar a la tarea)
+  uint32_t read_errors;  // Errores de adc_continuous_read distintos de timeout
+} adc_driver_stats_t;
+
+// Carga la calibración (adc_calib), configura el ADC continuo con los canales
+// de Kconfig y arranca la tarea que drena cada trama DMA. Requiere NVS.
 esp_err_t adc_driver_init(adc_continuous_handle_t *out_handle);
+
+// Número de canales del patrón y su lista (rellena results[i].channel)
+int adc_driver_num_channels(void);
+int adc_driver_get_channels(adc_channel_result_t *results, int max_channels);
+
+// Estadísticas de la ventana por defecto; no bloquea
 int adc_driver_read_multi(adc_continuous_handle_t handle,adc_channel_result_t *results,int num_channels);
+
+// Estadísticas de los últimos window_ms de cada canal pedido; no bloquea.
+// Devuelve el total de muestras agregadas.
+int adc_driver_read_window(adc_channel_result_t *results, int num_channels, uint32_t window_ms);
+
+// Estadísticas de todas las muestras recibidas desde la llamada anterior
+// (acumuladas durante la decodificación, sin depender del tamaño del buffer)
+int adc_driver_read_interval(adc_channel_result_t *results, int num_channels);
+
+// Copia las 'count' muestras crudas más recientes de un canal (orden
+// cronológico) para análisis por bloques; no bloquea. Devuelve las copiadas.
+uint32_t adc_driver_copy_recent(uint8_t channel, uint16_t *out, uint32_t count);
+
+void adc_driver_get_stats(adc_driver_stats_t *out);
+
+// Para el ADC continuo (p. ej. antes de light sleep). Sin efecto con
+// CONFIG_ADC_ADAPTIVE, donde el ADC ya está parado entre capturas.
+esp_err_t adc_driver_stop(void);
+
+// Descarta las muestras y el estado de los decimadores de antes de la parada,
+// vuelve a arrancar el ADC y bloquea hasta tener window_ms de muestras nuevas
+// (ESP_ERR_TIMEOUT si no llegan). Sin efecto con CONFIG_ADC_ADAPTIVE.
+esp_err_t adc_driver_start(uint32_t window_ms);
+
+// --- Modo de adquisición y consumo ---
+typedef enum {
+  ADC_DRIVER_MODE_CONTINUOUS,  // DMA siempre activo
+  ADC_DRIVER_MODE_BURST,       // DMA solo durante la ventana de captura
+  ADC_DRIVER_MODE_ONESHOT,     // Lecturas sueltas, sin DMA
+} adc_driver_mode_t;
+
+typedef struct {
+  adc_driver_mode_t mode;
+  uint32_t sample_freq_hz;        // Frecuencia total del patrón (0 en oneshot)
+  uint32_t window_ms;             // Duración de la captura
+  uint32_t samples;               // Muestras obtenidas (todos los canales)
+  int64_t on_us;                  // Tiempo con el ADC convirtiendo (o en espera activa entre lecturas)
+  float duty_cycle;               // on_us / intervalo de informe
+  uint32_t energy_per_sample_nj;  // Estimada con CONFIG_ADC_ACTIVE_POWER_UW
+} adc_driver_power_t;
+
+// Prepara muestras frescas para un intervalo de informe. Con CONFIG_ADC_ADAPTIVE
+// elige ráfaga DMA (frecuencia y ventana según la varianza medida en la captura
+// anterior) u oneshot para intervalos lentos y señal estable, y deja el ADC
+// parado; sin él no hace nada. Llamar antes de leer la ventana.
+esp_err_t adc_driver_capture(uint32_t interval_ms, adc_driver_power_t *power);
+const char *adc_driver_mode_name(adc_driver_mode_t mode);
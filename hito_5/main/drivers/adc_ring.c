@@ -0,0 +1,82 @@
+#include "adc_ring.h"
+#include <string.h>
+
+#define READ_RETRIES 3
+
+void adc_ring_reset(adc_ring_t *ring) {
+  memset(ring->data, 0, sizeof(ring->data));
+  atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+}
+
+void adc_ring_push(adc_ring_t *ring, const uint16_t *samples, uint32_t count) {
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+  // Si llegan más muestras que la capacidad solo interesan las últimas
+  if (count > ADC_RING_CAPACITY) {
+    samples += count - ADC_RING_CAPACITY;
+    head += count - ADC_RING_CAPACITY;
+    count = ADC_RING_CAPACITY;
+  }
+
+  uint32_t pos = head & ADC_RING_MASK;
+  uint32_t first = ADC_RING_CAPACITY - pos;
+  if (first > count) first = count;
+
+  memcpy(&ring->data[pos], samples, first * sizeof(uint16_t));
+  memcpy(&ring->data[0], samples + first, (count - first) * sizeof(uint16_t));
+
+  // Publica las muestras: el consumidor que vea el nuevo head ve los datos
+  atomic_store_explicit(&ring->head, head + count, memory_order_release);
+}
+
+uint32_t adc_ring_accumulate_recent(adc_ring_t *ring, uint32_t count, adc_accum_t *acc, int slot) {
+  if (count > ADC_RING_MAX_READ) count = ADC_RING_MAX_READ;
+
+  for (int attempt = 0; attempt < READ_RETRIES; attempt++) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint32_t n = (count < head) ? count : head;
+    uint32_t start = head - n;
+
+    adc_accum_t local;
+    adc_accum_reset(&local, slot);
+    for (uint32_t i = start; i != head; i++) {
+      adc_accum_add(&local, slot, ring->data[i & ADC_RING_MASK]);
+    }
+
+    // Si el productor ha dado la vuelta sobre la ventana leída, se descarta.
+    // Cuenta también el push que pueda estar copiando datos sin haber
+    // publicado aún head: escribe hasta ADC_FRAME_SAMPLES más allá de head_after
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t head_after = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head_after - start + ADC_FRAME_SAMPLES <= ADC_RING_CAPACITY) {
+      adc_accum_merge(acc, &local, slot);
+      return n;
+    }
+  }
+
+  return 0;
+}
+
+uint32_t adc_ring_copy_recent(adc_ring_t *ring, uint16_t *out, uint32_t count) {
+  if (count > ADC_RING_MAX_READ) count = ADC_RING_MAX_READ;
+
+  for (int attempt = 0; attempt < READ_RETRIES; attempt++) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint32_t n = (count < head) ? count : head;
+    uint32_t start = head - n;
+
+    uint32_t pos = start & ADC_RING_MASK;
+    uint32_t first = ADC_RING_CAPACITY - pos;
+    if (first > n) first = n;
+    memcpy(out, &ring->data[pos], first * sizeof(uint16_t));
+    memcpy(out + first, &ring->data[0], (n - first) * sizeof(uint16_t));
+
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t head_after = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head_after - start + ADC_FRAME_SAMPLES <= ADC_RING_CAPACITY) {
+      return n;
+    }
+  }
+
+  return 0;
+}
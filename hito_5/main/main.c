@@ -5,7 +5,9 @@
 #include "sensors/ldr_sensor.h"
 #include "sensors/bme680_sensor.h"
 #include "utils/math_utils.h"
+#include "utils/light_lut.h"
 #include "utils/telegram_bot.h"
+#include "utils/deadband.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
@@ -19,8 +21,22 @@
 
 static const char *TAG = "MAIN";
 
+#define MAX_SILENCE_MS (CONFIG_REPORT_MAX_SILENCE_S * 1000)
+
 // ==================== VARIABLES GLOBALES ====================
 static int g_sensor_interval_ms = 2000; // intervalo por defecto 2s
+static bool g_radio_on = true;          // WiFi y MQTT activos
+static volatile bool g_force_send = false;
+
+// Filtros de publicación por métrica (banda muerta + silencio máximo)
+static deadband_t g_light_db = DEADBAND_INIT(CONFIG_REPORT_LIGHT_DELTA, 0.0f, MAX_SILENCE_MS);
+static deadband_t g_temp_db = DEADBAND_INIT(CONFIG_REPORT_TEMP_DELTA_X10 / 10.0f, 0.0f, MAX_SILENCE_MS);
+static deadband_t g_hum_db = DEADBAND_INIT(CONFIG_REPORT_HUM_DELTA_X10 / 10.0f, 0.0f, MAX_SILENCE_MS);
+static deadband_t g_press_db = DEADBAND_INIT(CONFIG_REPORT_PRESS_DELTA_X10 / 10.0f, 0.0f, MAX_SILENCE_MS);
+static deadband_t g_gas_db = DEADBAND_INIT(0.0f, CONFIG_REPORT_GAS_DELTA_PCT / 100.0f, MAX_SILENCE_MS);
+#if CONFIG_LDR_FLICKER
+static deadband_t g_flicker_db = DEADBAND_INIT(CONFIG_REPORT_FLICKER_DELTA, 0.0f, MAX_SILENCE_MS);
+#endif
 
 // ==================== RPC ====================
 static void handle_rpc(const char *method, const char *params) {
@@ -35,46 +51,78 @@ static void handle_rpc(const char *method, const char *params) {
     }
   } else if (strcmp(method, "forceSend") == 0) {
     ESP_LOGI(TAG, "Se solicitó envío forzado (forceSend)");
+    g_force_send = true;
   } else {
     ESP_LOGW(TAG, "RPC desconocido: %s", method);
   }
 }
 
-// ==================== LIGHT SLEEP ====================
-static void enter_light_sleep_ms(uint32_t ms, adc_continuous_handle_t adc_handle) {
-  ESP_LOGI(TAG, "Preparando para entrar en light sleep %d ms...", ms);
-
-  if (adc_handle) {
-    adc_continuous_stop(adc_handle);
-    ESP_LOGI(TAG, "ADC detenido antes de dormir");
-  }
+// ==================== RADIO ====================
+static void radio_stop(void) {
+  if (!g_radio_on) return;
 
   mqtt_manager_disconnect();
   ESP_LOGI(TAG, "MQTT desconectado");
 
   esp_wifi_stop();
   vTaskDelay(pdMS_TO_TICKS(100));
-  ESP_LOGI(TAG, "WiFi detenido, entrando en light sleep...");
-
-  esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000ULL);
-  esp_light_sleep_start();
+  ESP_LOGI(TAG, "WiFi detenido");
+  g_radio_on = false;
+}
 
-  ESP_LOGI(TAG, "Despertando de light sleep");
+// Solo se reconecta cuando hay algo que publicar
+static void radio_start(void) {
+  if (g_radio_on) return;
 
   esp_wifi_start();
   ESP_LOGI(TAG, "Esperando reconexión WiFi...");
   while (!wifi_manager_is_connected()) {
     vTaskDelay(pdMS_TO_TICKS(500));
   }
-  ESP_LOGI(TAG, "WiFi reconectado tras light sleep");
+  ESP_LOGI(TAG, "WiFi reconectado");
   vTaskDelay(pdMS_TO_TICKS(3000));
+
+  mqtt_manager_reconnect();
+  ESP_LOGI(TAG, "MQTT reconectado");
+  g_radio_on = true;
+}
+
+// ==================== LIGHT SLEEP ====================
+static void enter_light_sleep_ms(uint32_t ms, adc_continuous_handle_t adc_handle) {
+  ESP_LOGI(TAG, "Preparando para entrar en light sleep %d ms...", ms);
+
+  // En modo adaptativo el ADC ya está parado fuera de cada captura
+  if (adc_handle) {
+    adc_driver_stop();
+    ESP_LOGI(TAG, "ADC detenido antes de dormir");
+  }
+
+  radio_stop();
+  ESP_LOGI(TAG, "Entrando en light sleep...");
+
+  esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000ULL);
+  esp_light_sleep_start();
+
+  ESP_LOGI(TAG, "Despertando de light sleep");
+
+  // Las muestras de antes de dormir se descartan: la siguiente lectura espera
+  // a tener una ventana completa de muestras nuevas
   if (adc_handle) {
-    adc_continuous_start(adc_handle);
-    ESP_LOGI(TAG, "ADC reiniciado tras light sleep");
+    if (adc_driver_start(ldr_settle_ms()) == ESP_OK) {
+      ESP_LOGI(TAG, "ADC reiniciado tras light sleep");
+    } else {
+      ESP_LOGW(TAG, "ADC reiniciado sin muestras nuevas suficientes");
+    }
   }
+}
 
-  mqtt_manager_reconnect();
-  ESP_LOGI(TAG, "MQTT reconectado tras light sleep");
+// Añade "clave":valor al JSON si la métrica sale de su banda muerta
+static int append_metric(char *buf, size_t size, int len, deadband_t *db, const char *key, float value, const char *fmt) {
+  if (len < 0 || (size_t)len >= size || !deadband_update(db, value)) return len;
+
+  len += snprintf(buf + len, size - len, "%s\"%s\":", (len > 1) ? "," : "", key);
+  if ((size_t)len < size) len += snprintf(buf + len, size - len, fmt, value);
+  return len;
 }
 
 // ==================== MAIN ====================
@@ -104,6 +152,15 @@ void app_main(void) {
     return;
   }
   ldr_init(adc_handle);
+#if CONFIG_LDR_LUT_BENCHMARK
+  ldr_benchmark_light_lut();
+#endif
+#if CONFIG_ADC_DECIM_BENCHMARK
+  adc_decim_benchmark(ADC_DRIVER_SAMPLE_FREQ_HZ / adc_driver_num_channels());
+#endif
+#if CONFIG_LDR_FLICKER_BENCHMARK
+  flicker_benchmark(ADC_DRIVER_SAMPLE_FREQ_HZ / adc_driver_num_channels());
+#endif
 
   // ---------- Inicialización BME680 ----------
   if (bme680_init_sensor() != ESP_OK) {
@@ -114,33 +171,74 @@ void app_main(void) {
 
   // ---------- Bucle principal ----------
   while (true) {
-    // LDR
-    float resistance = ldr_get_resistance(adc_handle);
-    uint8_t light_level = 0;
-    if (resistance >= 0) {
-      light_level = calculate_light_level(resistance);
-      mqtt_manager_publish_light(light_level);
-      ESP_LOGI(TAG, "LDR: %.2f Ω, Luz: %d%%", resistance, light_level);
+    // LDR: con CONFIG_ADC_ADAPTIVE la captura del intervalo se hace aquí
+    adc_driver_power_t adc_power;
+    adc_driver_capture((uint32_t)g_sensor_interval_ms, &adc_power);
+    int raw_value = ldr_get_raw(adc_handle);
+
+    if (g_force_send) {
+      g_force_send = false;
+      deadband_reset(&g_light_db);
+      deadband_reset(&g_temp_db);
+      deadband_reset(&g_hum_db);
+      deadband_reset(&g_press_db);
+      deadband_reset(&g_gas_db);
+#if CONFIG_LDR_FLICKER
+      deadband_reset(&g_flicker_db);
+#endif
     }
 
+    // Telemetría: solo las métricas que han cambiado o llevan demasiado en silencio
+    char payload[320] = "{";
+    int len = 1;
+
+    if (raw_value >= 0) {
+      uint8_t light_level = light_level_from_raw(raw_value);
+      len = append_metric(payload, sizeof(payload), len, &g_light_db, "light", light_level, "%.0f");
+      ESP_LOGI(TAG, "LDR: raw %d, %.2f Ω, Luz: %d%%", raw_value, ldr_raw_to_resistance(raw_value), light_level);
+#if CONFIG_LDR_FLICKER
+      flicker_result_t flicker;
+      if (ldr_get_flicker(&flicker) == ESP_OK) {
+        int before = len;
+        len = append_metric(payload, sizeof(payload), len, &g_flicker_db, "flicker_percent", flicker.percent, "%.1f");
+        if (len != before) {
+          len += snprintf(payload + len, sizeof(payload) - len, ",\"flicker_index\":%.3f,\"flicker_hz\":%.1f",
+                          flicker.index, flicker.dominant_hz);
+        }
+      }
+#endif
+    }
+
+    adc_driver_stats_t adc_stats;
+    adc_driver_get_stats(&adc_stats);
+    ESP_LOGI(TAG, "ADC: tramas=%lu muestras=%lu descartadas=%lu desbordes=%lu errores=%lu",
+             adc_stats.frames, adc_stats.samples, adc_stats.dropped, adc_stats.overflows, adc_stats.read_errors);
+    ESP_LOGI(TAG, "ADC %s: %lu Hz, ventana %lu ms, %lu muestras, ciclo de trabajo %.3f%%, %lu nJ/muestra",
+             adc_driver_mode_name(adc_power.mode), adc_power.sample_freq_hz, adc_power.window_ms, adc_power.samples,
+             adc_power.duty_cycle * 100.0f, adc_power.energy_per_sample_nj);
+
     // BME680
     bme680_data_t bme;
     if (bme680_read_data(&bme) == ESP_OK) {
       ESP_LOGI(TAG, "BME680 -> T: %.2f°C, H: %.2f%%, P: %.2f hPa, G: %.2f kΩ",
                bme.temperature, bme.humidity, bme.pressure, bme.gas_resistance);
+      len = append_metric(payload, sizeof(payload), len, &g_temp_db, "temperature", bme.temperature, "%.2f");
+      len = append_metric(payload, sizeof(payload), len, &g_hum_db, "humidity", bme.humidity, "%.2f");
+      len = append_metric(payload, sizeof(payload), len, &g_press_db, "pressure", bme.pressure, "%.2f");
+      len = append_metric(payload, sizeof(payload), len, &g_gas_db, "gas", bme.gas_resistance, "%.2f");
+    } else {
+      ESP_LOGW(TAG, "Error leyendo datos del BME680");
+    }
 
-      // Enviar datos a ThingsBoard
-      char payload[256];
-      snprintf(payload, sizeof(payload),
-               "{\"temperature\":%.2f,\"humidity\":%.2f,\"pressure\":%.2f,"
-               "\"gas\":%.2f,\"light\":%d}",
-               bme.temperature, bme.humidity, bme.pressure,
-               bme.gas_resistance, light_level);
-
+    // Enviar a ThingsBoard solo si hay algo nuevo; si no, la radio sigue apagada
+    if (len > 1 && (size_t)len < sizeof(payload) - 1) {
+      snprintf(payload + len, sizeof(payload) - len, "}");
+      radio_start();
       mqtt_manager_publish_json(payload);
       ESP_LOGI(TAG, "Datos enviados a ThingsBoard: %s", payload);
     } else {
-      ESP_LOGW(TAG, "Error leyendo datos del BME680");
+      ESP_LOGI(TAG, "Sin cambios que publicar (luz: %lu, temperatura: %lu publicaciones evitadas)",
+               g_light_db.suppressed, g_temp_db.suppressed);
     }
 
     // Ahorro energético con reconexión segura
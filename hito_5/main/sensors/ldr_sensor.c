@@ -1,11 +1,14 @@
 #include "ldr_sensor.h"
 #include "esp_log.h"
+#include "sdkconfig.h"
 #include "utils/math_utils.h"
+#include "utils/light_lut.h"
+#include "drivers/adc_calib.h"
+#include "drivers/adc_ring.h"
 
 #define TAG "LDR_SENSOR"
-#define FIXED_RESISTOR 10000.0f
+#define FIXED_RESISTOR ((float)CONFIG_LDR_FIXED_RESISTOR)
 #define VCC 3.3f
-#define VCC_MAX_VALUE 4095.0f
 
 static adc_channel_result_t ldr_result = {
   .channel = ADC_CHANNEL_0,
@@ -16,22 +19,102 @@ void ldr_init(adc_continuous_handle_t handle) {
   ESP_LOGI(TAG, "LDR inicializado (canal ADC0)");
 }
 
-float ldr_get_resistance(adc_continuous_handle_t handle) {
-  if (!handle) return -1.0f;
+uint32_t ldr_settle_ms(void) {
+  uint32_t ms = LDR_WINDOW_MS;
+#if CONFIG_LDR_FLICKER
+  const uint32_t rate = ADC_DRIVER_SAMPLE_FREQ_HZ / adc_driver_num_channels();
+  const uint32_t fft_ms = (FLICKER_FFT_SIZE * 1000 + rate - 1) / rate;
+  if (fft_ms > ms) ms = fft_ms;
+#endif
+  return ms;
+}
 
-  if (adc_driver_read_multi(handle, &ldr_result, 1) <= 0) {
+int ldr_get_raw(adc_continuous_handle_t handle) {
+  if (!handle) return -1;
+
+  if (adc_driver_read_window(&ldr_result, 1, LDR_WINDOW_MS) <= 0) {
     ESP_LOGW(TAG, "No se pudieron leer datos del ADC");
-    return -1.0f;
+    return -1;
   }
 
-  uint16_t raw_value = ldr_result.average;
-  if (raw_value == 0) return 0.0f;
+  // Salida decimada (sin rizado de red), redondeada a 12 bits
+  int raw = (ldr_result.filtered + (1 << (ADC_DECIM_FRAC_BITS - 1))) >> ADC_DECIM_FRAC_BITS;
+  return (raw > 4095) ? 4095 : raw;
+}
 
-  float v_adc = ((float)raw_value / VCC_MAX_VALUE) * VCC;
+float ldr_raw_to_resistance(uint16_t raw_value) {
+  // Tensión corregida con la calibración de eFuse (lectura de tabla)
+  uint16_t mv = adc_calib_raw_to_mv(raw_value);
+  if (mv == 0) return 0.0f;
+
+  float v_adc = mv / 1000.0f;
   if (v_adc >= VCC) v_adc = VCC - 0.001f;
-  if (v_adc <= 0.0f) v_adc = 0.001f;
 
   float resistance = FIXED_RESISTOR * (v_adc / (VCC - v_adc));
   return resistance;
 }
 
+float ldr_get_resistance(adc_continuous_handle_t handle) {
+  int raw_value = ldr_get_raw(handle);
+  if (raw_value < 0) return -1.0f;
+
+  return ldr_raw_to_resistance(raw_value);
+}
+
+int ldr_get_light_level(adc_continuous_handle_t handle) {
+  int raw_value = ldr_get_raw(handle);
+  if (raw_value < 0) return -1;
+
+  return light_level_from_raw(raw_value);
+}
+
+#if CONFIG_LDR_FLICKER
+// El bloque debe dejar sitio a la trama que el productor pueda estar copiando;
+// si no, la lectura sin bloqueos fallaría siempre y no habría análisis
+_Static_assert(FLICKER_FFT_SIZE + ADC_FRAME_SAMPLES <= CONFIG_ADC_RING_SAMPLES, "El bloque de la FFT no cabe en el buffer circular");
+
+esp_err_t ldr_get_flicker(flicker_result_t *out) {
+  static uint16_t block[FLICKER_FFT_SIZE];
+
+  if (adc_driver_copy_recent(ldr_result.channel, block, FLICKER_FFT_SIZE) < FLICKER_FFT_SIZE) {
+    ESP_LOGW(TAG, "Muestras insuficientes para el análisis de parpadeo");
+    return ESP_ERR_INVALID_STATE;
+  }
+
+  flicker_analyze(block, ADC_DRIVER_SAMPLE_FREQ_HZ / adc_driver_num_channels(), out);
+  return ESP_OK;
+}
+#endif
+
+#if CONFIG_LDR_LUT_BENCHMARK
+#include "esp_cpu.h"
+
+// Ambas rutas parten del código ADC y pasan por la tabla de calibración:
+// la de referencia calcula tensión, resistencia y log10f en coma flotante
+void ldr_benchmark_light_lut(void) {
+  volatile uint32_t sink = 0;
+  int mismatches = 0;
+
+  uint32_t start = esp_cpu_get_cycle_count();
+  for (uint16_t raw = 0; raw < ADC_CALIB_TABLE_SIZE; raw++) {
+    sink += calculate_light_level(ldr_raw_to_resistance(raw));
+  }
+  uint32_t float_cycles = esp_cpu_get_cycle_count() - start;
+
+  start = esp_cpu_get_cycle_count();
+  for (uint16_t raw = 0; raw < ADC_CALIB_TABLE_SIZE; raw++) {
+    sink += light_level_from_raw(raw);
+  }
+  uint32_t lut_cycles = esp_cpu_get_cycle_count() - start;
+
+  for (uint16_t raw = 0; raw < ADC_CALIB_TABLE_SIZE; raw++) {
+    int diff = (int)calculate_light_level(ldr_raw_to_resistance(raw)) - light_level_from_raw(raw);
+    if (diff != 0) mismatches++;
+  }
+
+  ESP_LOGI(TAG, "Benchmark nivel de luz (%s): float %lu ciclos/muestra, tabla %lu ciclos/muestra, %d discrepancias",
+           adc_calib_is_calibrated() ? "calibrado" : "modelo nominal",
+           float_cycles / ADC_CALIB_TABLE_SIZE, lut_cycles / ADC_CALIB_TABLE_SIZE, mismatches);
+  (void)sink;
+}
+#endif
@@ -0,0 +1,33 @@
+#include "deadband.h"
+#include "esp_timer.h"
+#include <math.h>
+
+bool deadband_update(deadband_t *db, float value) {
+  int64_t now = esp_timer_get_time();
+
+  bool report = !db->sent;
+  if (!report) {
+    float band = db->delta;
+    float rel_band = db->delta_rel * fabsf(db->last);
+    if (rel_band > band) band = rel_band;
+
+    report = fabsf(value - db->last) >= band;
+    if (!report && db->max_silence_ms > 0) {
+      report = (now - db->last_us) >= (int64_t)db->max_silence_ms * 1000;
+    }
+  }
+
+  if (!report) {
+    db->suppressed++;
+    return false;
+  }
+
+  db->last = value;
+  db->last_us = now;
+  db->sent = true;
+  return true;
+}
+
+void deadband_reset(deadband_t *db) {
+  db->sent = false;
+}
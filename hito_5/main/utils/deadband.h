@@ -0,0 +1,28 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- Filtro de publicación por banda muerta ---
+// Una métrica solo se publica si se aleja del último valor PUBLICADO más de
+// la banda (absoluta o relativa, la mayor) o si lleva max_silence_ms sin
+// publicarse. Comparar con lo publicado, y no con la última lectura, da la
+// histéresis: una deriva lenta acaba publicándose y el ruido no.
+typedef struct {
+  float delta;              // Cambio absoluto mínimo
+  float delta_rel;          // Cambio mínimo relativo al último valor publicado (0 = sin uso)
+  uint32_t max_silence_ms;  // Publicación forzada aunque no cambie (0 = nunca)
+
+  float last;               // Último valor publicado
+  int64_t last_us;
+  bool sent;
+  uint32_t suppressed;      // Publicaciones evitadas
+} deadband_t;
+
+#define DEADBAND_INIT(abs, rel, silence_ms) \
+  { .delta = (abs), .delta_rel = (rel), .max_silence_ms = (silence_ms) }
+
+// true si 'value' debe publicarse; en ese caso pasa a ser la referencia
+bool deadband_update(deadband_t *db, float value);
+
+// Fuerza la publicación en la próxima llamada (p. ej. tras reconectar)
+void deadband_reset(deadband_t *db);
@@ -0,0 +1,25 @@
+#pragma once
+#include <stdint.h>
+#include "sdkconfig.h"
+
+#if CONFIG_LDR_FLICKER
+
+#define FLICKER_FFT_SIZE CONFIG_LDR_FLICKER_FFT_SIZE
+
+// Métricas de parpadeo sobre un bloque de códigos ADC (proporcionales a la
+// tensión del divisor, no a lux: sirven para detectar y comparar parpadeo)
+typedef struct {
+  float percent;      // 100·(máx − mín)/(máx + mín)
+  float index;        // Área sobre la media / área total (IES)
+  float dominant_hz;  // Pico del espectro sin la componente continua
+} flicker_result_t;
+
+// Analiza FLICKER_FFT_SIZE muestras consecutivas: ventana de Hann y FFT real
+// radix-2 en coma flotante. Usa buffers estáticos: no es reentrante.
+void flicker_analyze(const uint16_t *samples, uint32_t sample_rate_hz, flicker_result_t *out);
+
+#if CONFIG_LDR_FLICKER_BENCHMARK
+void flicker_benchmark(uint32_t sample_rate_hz);
+#endif
+
+#endif